@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// chapter : Number Processing
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// section : Long Arithmetic
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// content : Allocations per Operation with Pool Allocator and Workspace
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "allocations.hpp"
+#include "task.hpp"
+#include "tools.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+template < typename F > auto count(F && f)
+{
+	f();
+
+	auto n = allocations.load();
+
+	for (auto i = 0; i < 10; ++i)
+	{
+		f();
+	}
+
+	return static_cast < double > (allocations - n) / 10;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	std::mt19937_64 engine(0);
+
+	Integer::Workspace workspace;
+
+	std::cout << std::setw(8) << "limbs" << std::setw(16) << "multiply" << std::setw(16) << "divmod";
+
+	std::cout << std::setw(16) << "sqrt" << std::setw(16) << "print" << '\n';
+
+	for (auto size : { 4uz, 16uz, 64uz, 256uz, 1'024uz, 4'096uz })
+	{
+		auto x = make_integer(2 * size, engine), y = make_integer(size, engine);
+
+		auto multiply_n = count([&](){ multiply(y, y, workspace); });
+
+		auto divmod_n = count([&](){ divmod(x, y, workspace); });
+
+		auto sqrt_n = count([&](){ sqrt(x); });
+
+		auto print_n = count([&](){ x.to_string(); });
+
+		std::cout << std::setw(8) << size << std::setw(16) << multiply_n << std::setw(16) << divmod_n;
+
+		std::cout << std::setw(16) << sqrt_n << std::setw(16) << print_n << '\n';
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
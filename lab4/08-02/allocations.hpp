@@ -0,0 +1,75 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+// chapter : Number Processing
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+// section : Long Arithmetic
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+// content : Counting Replacements of Global Operators new and delete
+//
+// content : Include from exactly one translation unit of a program
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline std::atomic < std::size_t > allocations = 0, allocated_bytes = 0;
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+[[gnu::noinline]] void * operator new(std::size_t size)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+
+	allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+	if (auto pointer = std::malloc(size); pointer)
+	{
+		return pointer;
+	}
+
+	throw std::bad_alloc();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+[[gnu::noinline]] void * operator new(std::size_t size, std::align_val_t alignment)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+
+	allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+	auto step = static_cast < std::size_t > (alignment);
+
+	if (auto pointer = std::aligned_alloc(step, (std::max(size, 1uz) + step - 1) / step * step); pointer)
+	{
+		return pointer;
+	}
+
+	throw std::bad_alloc();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+[[gnu::noinline]] void operator delete(void * pointer) noexcept { std::free(pointer); }
+
+[[gnu::noinline]] void operator delete(void * pointer, std::size_t) noexcept { std::free(pointer); }
+
+[[gnu::noinline]] void operator delete(void * pointer, std::align_val_t) noexcept { std::free(pointer); }
+
+[[gnu::noinline]] void operator delete(void * pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+//////////////////////////////////////////////////////////////////////////////////////////////
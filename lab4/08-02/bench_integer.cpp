@@ -0,0 +1,328 @@
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// chapter : Number Processing
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// section : Long Arithmetic
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// content : Benchmarks of Long Arithmetic with Google Benchmark
+//
+// content : Build with -DCMAKE_BUILD_TYPE=Release for meaningful timings
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <random>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "allocations.hpp"
+#include "task.hpp"
+#include "tools.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+std::mt19937_64 engine(0);
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto make_decimal(std::size_t length)
+{
+	return Integer(make_string(length, engine));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+template < typename F > void run(benchmark::State & state, F && f)
+{
+	auto allocations_0 = allocations.load(), allocated_bytes_0 = allocated_bytes.load();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(f());
+	}
+
+	auto iterations = benchmark::Counter::kAvgIterations;
+
+	state.counters["allocs"] = benchmark::Counter(static_cast < double > (allocations - allocations_0), iterations);
+
+	state.counters["bytes"] = benchmark::Counter(static_cast < double > (allocated_bytes - allocated_bytes_0), iterations);
+
+	state.SetComplexityN(state.range(0));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void add(benchmark::State & state)
+{
+	auto x = make_decimal(state.range(0)), y = make_decimal(state.range(0));
+
+	run(state, [&](){ return x + y; });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void multiply_schoolbook(benchmark::State & state)
+{
+	auto x = make_decimal(state.range(0)), y = make_decimal(state.range(0));
+
+	auto threshold = std::exchange(Integer::s_karatsuba_threshold, std::numeric_limits < std::size_t > ::max());
+
+	run(state, [&](){ return multiply(x, y); });
+
+	Integer::s_karatsuba_threshold = threshold;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void multiply(benchmark::State & state)
+{
+	auto x = make_decimal(state.range(0)), y = make_decimal(state.range(0));
+
+	run(state, [&](){ return multiply(x, y); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void dot(benchmark::State & state)
+{
+	std::vector < Integer > x, y;
+
+	for (auto i = 0; i < 64; ++i)
+	{
+		x.push_back(make_decimal(state.range(0)));
+
+		y.push_back(make_decimal(state.range(0)));
+	}
+
+	run(state, [&](){ return dot(x, y); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void dot_naive(benchmark::State & state)
+{
+	std::vector < Integer > x, y;
+
+	for (auto i = 0; i < 64; ++i)
+	{
+		x.push_back(make_decimal(state.range(0)));
+
+		y.push_back(make_decimal(state.range(0)));
+	}
+
+	run(state, [&]()
+	{ 
+		Integer z;
+
+		for (auto i = 0uz; i < std::size(x); ++i)
+		{
+			z = z + x[i] * y[i];
+		}
+
+		return z;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void accumulate(benchmark::State & state)
+{
+	std::vector < Integer > x;
+
+	for (auto i = 0; i < 1'024; ++i)
+	{
+		x.push_back(make_decimal(state.range(0)));
+	}
+
+	run(state, [&]()
+	{ 
+		Accumulator accumulator;
+
+		for (auto const & y : x)
+		{
+			accumulator += y;
+		}
+
+		return accumulator.value();
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void accumulate_naive(benchmark::State & state)
+{
+	std::vector < Integer > x;
+
+	for (auto i = 0; i < 1'024; ++i)
+	{
+		x.push_back(make_decimal(state.range(0)));
+	}
+
+	run(state, [&]()
+	{ 
+		Integer z;
+
+		for (auto const & y : x)
+		{
+			z += y;
+		}
+
+		return z;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void divmod(benchmark::State & state)
+{
+	auto x = make_decimal(2 * state.range(0)), y = make_decimal(state.range(0));
+
+	run(state, [&](){ return divmod(x, y); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void sqrt(benchmark::State & state)
+{
+	auto x = make_decimal(state.range(0));
+
+	run(state, [&](){ return sqrt(x); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void pow(benchmark::State & state)
+{
+	auto exponent = static_cast < unsigned int > (static_cast < double > (state.range(0)) / std::log10(3.0));
+
+	run(state, [&](){ return pow(Integer(3), exponent); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void factorial(benchmark::State & state)
+{
+	auto n = static_cast < unsigned int > (state.range(0));
+
+	run(state, [&](){ return product(std::views::iota(1u, n + 1)); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void factorial_naive(benchmark::State & state)
+{
+	auto n = static_cast < unsigned int > (state.range(0));
+
+	run(state, [&]()
+	{ 
+		Integer x = 1;
+
+		for (auto i = 1u; i <= n; ++i)
+		{
+			x *= i;
+		}
+
+		return x;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void parse(benchmark::State & state)
+{
+	auto string = make_string(state.range(0), engine);
+
+	run(state, [&](){ return Integer(string); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void print(benchmark::State & state)
+{
+	auto x = make_decimal(state.range(0));
+
+	run(state, [&](){ return x.to_string(); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void hash(benchmark::State & state)
+{
+	std::mt19937_64 engine(0);
+
+	std::vector < Integer::digit_t > digits(static_cast < std::size_t > (state.range(0)));
+
+	for (auto & digit : digits)
+	{
+		digit = engine();
+	}
+
+	run(state, [&](){ return Integer::hash(digits); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void hash_string(benchmark::State & state)
+{
+	auto x = make_integer(state.range(0), engine);
+
+	run(state, [&](){ return std::hash < std::string > ()(x.to_string()); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK(add                ) -> RangeMultiplier(10) -> Range(10, 1'000'000) -> Complexity();
+
+BENCHMARK(multiply_schoolbook) -> RangeMultiplier(10) -> Range(10,   100'000) -> Complexity();
+
+BENCHMARK(multiply           ) -> RangeMultiplier(10) -> Range(10, 1'000'000) -> Complexity();
+
+BENCHMARK(dot                ) -> RangeMultiplier(10) -> Range(10,   100'000) -> Complexity();
+
+BENCHMARK(dot_naive          ) -> RangeMultiplier(10) -> Range(10,   100'000) -> Complexity();
+
+BENCHMARK(accumulate         ) -> RangeMultiplier(10) -> Range(10,   100'000) -> Complexity();
+
+BENCHMARK(accumulate_naive   ) -> RangeMultiplier(10) -> Range(10,   100'000) -> Complexity();
+
+BENCHMARK(divmod             ) -> RangeMultiplier(10) -> Range(10, 1'000'000) -> Complexity();
+
+BENCHMARK(sqrt               ) -> RangeMultiplier(10) -> Range(10, 1'000'000) -> Complexity();
+
+BENCHMARK(pow                ) -> RangeMultiplier(10) -> Range(10, 1'000'000) -> Complexity();
+
+BENCHMARK(factorial          ) -> RangeMultiplier(10) -> Range(10, 1'000'000) -> Complexity();
+
+BENCHMARK(factorial_naive    ) -> RangeMultiplier(10) -> Range(10,   100'000) -> Complexity();
+
+BENCHMARK(parse              ) -> RangeMultiplier(10) -> Range(10, 1'000'000) -> Complexity();
+
+BENCHMARK(print              ) -> RangeMultiplier(10) -> Range(10, 1'000'000) -> Complexity();
+
+BENCHMARK(hash               ) -> RangeMultiplier(10) -> Range(1,  1'000'000) -> Complexity();
+
+BENCHMARK(hash_string        ) -> RangeMultiplier(10) -> Range(1,     10'000) -> Complexity();
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_MAIN();
+
+////////////////////////////////////////////////////////////////////////////////////////////
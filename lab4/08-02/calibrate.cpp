@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// chapter : Number Processing
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// section : Long Arithmetic
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// content : Multiplication, Division and GCD Thresholds Calibration
+//
+// content : Build with -DCMAKE_BUILD_TYPE=Release for meaningful timings
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+using namespace std::literals;
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "task.hpp"
+#include "tools.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void multiply_f(Integer const & x, Integer const & y) { multiply(x, y); }
+
+void divmod_f  (Integer const & x, Integer const & y) { divmod  (x, y); }
+
+void gcd_f     (Integer const & x, Integer const & y) { gcd     (x, y); }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+struct tier_t
+{
+	char const * name; std::size_t & threshold; std::size_t begin, end, scale;
+
+	void (*operation)(Integer const &, Integer const &);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	std::mt19937_64 engine(0);
+
+	tier_t tiers[] =
+	{
+		{ "karatsuba",        Integer::s_karatsuba_threshold,          4,    256, 1, multiply_f },
+		
+		{ "toom3",            Integer::s_toom3_threshold,             32,  2'048, 1, multiply_f },
+
+		{ "ntt",              Integer::s_ntt_threshold,              256, 16'384, 1, multiply_f },
+
+		{ "burnikel_ziegler", Integer::s_burnikel_ziegler_threshold,   8,  1'024, 2, divmod_f   },
+
+		{ "half_gcd",         Integer::s_half_gcd_threshold,         256,  8'192, 1, gcd_f      }
+	};
+
+	std::size_t thresholds[std::size(tiers)] = {};
+
+	for (auto i = 0uz; i < std::size(tiers); ++i)
+	{
+		thresholds[i] = std::exchange(tiers[i].threshold, std::numeric_limits < std::size_t > ::max());
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	for (auto & [name, threshold, begin, end, scale, operation] : tiers)
+	{
+		std::cout << std::setw(8) << "limbs" << std::setw(16) << "below, us" << std::setw(24) << name + ", us"s << '\n';
+
+		auto crossover = 0uz;
+
+		for (auto size = begin; size <= end; size += std::max(size / 4, 2uz))
+		{
+			auto x = make_integer(size * scale, engine), y = make_integer(size, engine);
+
+			threshold = size + 1;
+
+			auto time_1 = measure([&](){ operation(x, y); });
+
+			threshold = size;
+
+			auto time_2 = measure([&](){ operation(x, y); });
+
+			if (time_2 < time_1 && crossover == 0)
+			{
+				crossover = size;
+			}
+			else if (time_2 >= time_1)
+			{
+				crossover = 0;
+			}
+
+			std::cout << std::setw(8) << size << std::setw(16) << time_1 << std::setw(24) << time_2 << '\n';
+		}
+
+		threshold = crossover ? crossover : end;
+
+		std::cout << "s_" << name << "_threshold = " << threshold << "\n\n";
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	for (auto i = 0uz; i < std::size(tiers); ++i)
+	{
+		tiers[i].threshold = thresholds[i];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1112 @@
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// chapter : Number Processing
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// section : Long Arithmetic
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// content : Differential Fuzzing against a Reference Implementation
+//
+// content : Reference is GMP with INTEGER_FUZZ_GMP, otherwise a naive implementation
+//
+// content : Extended GCD, modular inverse and power, Rational and FixedInteger need GMP
+//
+// content : Build with -DINTEGER_LIBFUZZER=ON and Clang to run under libFuzzer
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(INTEGER_FUZZ_GMP)
+
+#include <gmpxx.h>
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "task.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(INTEGER_FUZZ_GMP)
+
+using Reference = mpz_class;
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto make_reference(std::vector < std::uint64_t > const & limbs, bool is_negative)
+{
+	Reference x;
+
+	mpz_import(x.get_mpz_t(), std::size(limbs), -1, sizeof(std::uint64_t), 0, 0, limbs.data());
+
+	return is_negative ? Reference(-x) : x;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto to_string(Reference const & x) -> std::string
+{
+	return x.get_str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto to_string(mpq_class const & x) -> std::string
+{
+	return x.get_str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto to_string(Rational const & x) -> std::string
+{
+	std::ostringstream stream;
+
+	stream << x;
+
+	return stream.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto powmod(Reference const & base, Reference const & exponent, Reference const & modulus)
+{
+	Reference x;
+
+	mpz_powm(x.get_mpz_t(), base.get_mpz_t(), exponent.get_mpz_t(), modulus.get_mpz_t());
+
+	return x;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto modinv(Reference const & x, Reference const & modulus) -> std::pair < bool, Reference >
+{
+	Reference y;
+
+	auto is_invertible = mpz_invert(y.get_mpz_t(), x.get_mpz_t(), modulus.get_mpz_t()) != 0;
+
+	return { is_invertible, y };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+template < std::size_t Bits > auto wrap(Reference const & x)
+{
+	Reference y;
+
+	mpz_fdiv_r_2exp(y.get_mpz_t(), x.get_mpz_t(), Bits);
+
+	if (mpz_tstbit(y.get_mpz_t(), Bits - 1))
+	{
+		y -= Reference(1) << Bits;
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#else
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+class Reference
+{
+public :
+
+	using limbs_t = std::vector < std::uint32_t > ;
+
+//  ----------------------------------------------------------------------------------------
+
+	Reference() = default;
+
+	Reference(long value) : m_is_negative(value < 0)
+	{
+		auto magnitude = value < 0 ? 0 - static_cast < std::uint64_t > (value) : static_cast < std::uint64_t > (value);
+
+		m_limbs = { static_cast < std::uint32_t > (magnitude), static_cast < std::uint32_t > (magnitude >> 32) };
+
+		normalize();
+	}
+
+	Reference(limbs_t limbs, bool is_negative) : m_is_negative(is_negative), m_limbs(std::move(limbs))
+	{
+		normalize();
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	friend auto operator-(Reference x)
+	{
+		x.m_is_negative = !x.m_is_negative;
+
+		x.normalize();
+
+		return x;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	friend auto operator+(Reference const & x, Reference const & y) -> Reference
+	{
+		if (x.m_is_negative == y.m_is_negative)
+		{
+			return Reference(add(x.m_limbs, y.m_limbs), x.m_is_negative);
+		}
+
+		if (compare(x.m_limbs, y.m_limbs) >= 0)
+		{
+			return Reference(sub(x.m_limbs, y.m_limbs), x.m_is_negative);
+		}
+
+		return Reference(sub(y.m_limbs, x.m_limbs), y.m_is_negative);
+	}
+
+	friend auto operator-(Reference const & x, Reference const & y) -> Reference
+	{
+		return x + -y;
+	}
+
+	friend auto operator*(Reference const & x, Reference const & y) -> Reference
+	{
+		return Reference(mul(x.m_limbs, y.m_limbs), x.m_is_negative != y.m_is_negative);
+	}
+
+	friend auto operator/(Reference const & x, Reference const & y) -> Reference
+	{
+		return Reference(divmod(x.m_limbs, y.m_limbs).first, x.m_is_negative != y.m_is_negative);
+	}
+
+	friend auto operator%(Reference const & x, Reference const & y) -> Reference
+	{
+		return Reference(divmod(x.m_limbs, y.m_limbs).second, x.m_is_negative);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	friend auto operator<<(Reference const & x, std::size_t shift) -> Reference
+	{
+		return Reference(shift_left(x.m_limbs, shift), x.m_is_negative);
+	}
+
+	friend auto operator>>(Reference const & x, std::size_t shift) -> Reference
+	{
+		if (x.m_is_negative)
+		{
+			return -((-x - 1) >> shift) - 1;
+		}
+
+		return Reference(shift_right(x.m_limbs, shift), false);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	friend auto operator~(Reference const & x) { return -x - 1; }
+
+	friend auto operator&(Reference const & x, Reference const & y) { return bitwise(x, y, std::bit_and < > ()); }
+
+	friend auto operator|(Reference const & x, Reference const & y) { return bitwise(x, y, std::bit_or  < > ()); }
+
+	friend auto operator^(Reference const & x, Reference const & y) { return bitwise(x, y, std::bit_xor < > ()); }
+
+//  ----------------------------------------------------------------------------------------
+
+	friend auto operator<(Reference const & x, Reference const & y)
+	{
+		if (x.m_is_negative != y.m_is_negative)
+		{
+			return x.m_is_negative;
+		}
+
+		auto result = compare(x.m_limbs, y.m_limbs);
+
+		return x.m_is_negative ? result > 0 : result < 0;
+	}
+
+	friend auto operator==(Reference const & x, Reference const & y) -> bool
+	{
+		return x.m_is_negative == y.m_is_negative && x.m_limbs == y.m_limbs;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	friend auto abs(Reference x)
+	{
+		x.m_is_negative = false;
+
+		return x;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	friend auto sqrt(Reference const & x) -> Reference
+	{
+		if (std::empty(x.m_limbs))
+		{
+			return x;
+		}
+
+		auto r = Reference(1) << ((std::size(x.m_limbs) * 32 + 1) / 2);
+
+		while (true)
+		{
+			auto s = (r + x / r) >> 1;
+
+			if (!(s < r))
+			{
+				return r;
+			}
+
+			r = std::move(s);
+		}
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	friend auto gcd(Reference const & x, Reference const & y) -> Reference
+	{
+		auto a = abs(x), b = abs(y);
+
+		if (std::empty(a.m_limbs) || std::empty(b.m_limbs))
+		{
+			return std::empty(a.m_limbs) ? b : a;
+		}
+
+		auto shift = std::min(a.trailing_zeros(), b.trailing_zeros());
+
+		a = a >> a.trailing_zeros();
+
+		while (!std::empty(b.m_limbs))
+		{
+			b = b >> b.trailing_zeros();
+
+			if (b < a)
+			{
+				std::swap(a, b);
+			}
+
+			b = b - a;
+		}
+
+		return a << shift;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	auto to_string() const -> std::string
+	{
+		std::vector < std::uint32_t > chunks;
+
+		for (auto limbs = m_limbs; !std::empty(limbs);)
+		{
+			std::uint64_t remainder = 0;
+
+			for (auto i = std::ssize(limbs) - 1; i >= 0; --i)
+			{
+				auto x = remainder << 32 | limbs[i];
+
+				limbs[i] = static_cast < std::uint32_t > (x / 1'000'000'000);
+
+				remainder = x % 1'000'000'000;
+			}
+
+			while (!std::empty(limbs) && !limbs.back())
+			{
+				limbs.pop_back();
+			}
+
+			chunks.push_back(static_cast < std::uint32_t > (remainder));
+		}
+
+		std::string string = m_is_negative ? "-" : "";
+
+		string += std::empty(chunks) ? "0" : std::to_string(chunks.back());
+
+		for (auto i = std::ssize(chunks) - 2; i >= 0; --i)
+		{
+			auto chunk = std::to_string(chunks[i]);
+
+			string += std::string(9 - std::size(chunk), '0') + chunk;
+		}
+
+		return string;
+	}
+
+private :
+
+	void normalize()
+	{
+		while (!std::empty(m_limbs) && !m_limbs.back())
+		{
+			m_limbs.pop_back();
+		}
+
+		if (std::empty(m_limbs))
+		{
+			m_is_negative = false;
+		}
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	auto trailing_zeros() const -> std::size_t
+	{
+		auto index = 0uz;
+
+		while (!m_limbs[index])
+		{
+			++index;
+		}
+
+		return index * 32 + std::countr_zero(m_limbs[index]);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	static auto compare(limbs_t const & x, limbs_t const & y) -> int
+	{
+		if (std::size(x) != std::size(y))
+		{
+			return std::size(x) < std::size(y) ? -1 : 1;
+		}
+
+		for (auto i = std::ssize(x) - 1; i >= 0; --i)
+		{
+			if (x[i] != y[i])
+			{
+				return x[i] < y[i] ? -1 : 1;
+			}
+		}
+
+		return 0;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	static auto add(limbs_t const & x, limbs_t const & y) -> limbs_t
+	{
+		limbs_t z(std::max(std::size(x), std::size(y)) + 1, 0);
+
+		std::uint64_t carry = 0;
+
+		for (auto i = 0uz; i < std::size(z); ++i)
+		{
+			carry += (i < std::size(x) ? x[i] : 0ull) + (i < std::size(y) ? y[i] : 0ull);
+
+			z[i] = static_cast < std::uint32_t > (carry);
+
+			carry >>= 32;
+		}
+
+		return z;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	static auto sub(limbs_t const & x, limbs_t const & y) -> limbs_t
+	{
+		limbs_t z(std::size(x), 0);
+
+		std::int64_t borrow = 0;
+
+		for (auto i = 0uz; i < std::size(z); ++i)
+		{
+			borrow += static_cast < std::int64_t > (x[i]) - (i < std::size(y) ? y[i] : 0ll);
+
+			z[i] = static_cast < std::uint32_t > (borrow);
+
+			borrow = borrow < 0 ? -1 : 0;
+		}
+
+		return z;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	static auto mul(limbs_t const & x, limbs_t const & y) -> limbs_t
+	{
+		limbs_t z(std::size(x) + std::size(y), 0);
+
+		for (auto i = 0uz; i < std::size(x); ++i)
+		{
+			std::uint64_t carry = 0;
+
+			for (auto j = 0uz; j < std::size(y); ++j)
+			{
+				carry += static_cast < std::uint64_t > (x[i]) * y[j] + z[i + j];
+
+				z[i + j] = static_cast < std::uint32_t > (carry);
+
+				carry >>= 32;
+			}
+
+			z[i + std::size(y)] = static_cast < std::uint32_t > (carry);
+		}
+
+		return z;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	static auto divmod(limbs_t const & x, limbs_t const & y) -> std::pair < limbs_t, limbs_t >
+	{
+		if (std::empty(y))
+		{
+			std::cerr << "reference division by zero\n";
+
+			std::abort();
+		}
+
+		if (compare(x, y) < 0)
+		{
+			return { {}, x };
+		}
+
+		auto m = std::ssize(x), n = std::ssize(y);
+
+		limbs_t q(m - n + 1, 0);
+
+		if (n == 1)
+		{
+			std::uint64_t remainder = 0;
+
+			for (auto i = m - 1; i >= 0; --i)
+			{
+				auto t = remainder << 32 | x[i];
+
+				q[i] = static_cast < std::uint32_t > (t / y[0]);
+
+				remainder = t % y[0];
+			}
+
+			return { q, { static_cast < std::uint32_t > (remainder) } };
+		}
+
+		auto shift = std::countl_zero(y.back());
+
+		auto u = shift_left(x, shift), v = shift_left(y, shift);
+
+		u.resize(m + 1, 0);
+
+		v.resize(n);
+
+		constexpr auto base = 1ull << 32;
+
+		for (auto j = m - n; j >= 0; --j)
+		{
+			auto top = static_cast < std::uint64_t > (u[j + n]) << 32 | u[j + n - 1];
+
+			auto qhat = top / v[n - 1], rhat = top % v[n - 1];
+
+			while (qhat >= base || qhat * v[n - 2] > (rhat << 32 | u[j + n - 2]))
+			{
+				--qhat;
+
+				if ((rhat += v[n - 1]) >= base)
+				{
+					break;
+				}
+			}
+
+			std::int64_t k = 0, t = 0;
+
+			for (auto i = 0; i < n; ++i)
+			{
+				auto p = qhat * v[i];
+
+				t = u[i + j] - k - static_cast < std::int64_t > (p & 0xff'ff'ff'ff);
+
+				u[i + j] = static_cast < std::uint32_t > (t);
+
+				k = static_cast < std::int64_t > (p >> 32) - (t >> 32);
+			}
+
+			t = u[j + n] - k;
+
+			u[j + n] = static_cast < std::uint32_t > (t);
+
+			q[j] = static_cast < std::uint32_t > (qhat);
+
+			if (t < 0)
+			{
+				--q[j];
+
+				std::uint64_t carry = 0;
+
+				for (auto i = 0; i < n; ++i)
+				{
+					carry += static_cast < std::uint64_t > (u[i + j]) + v[i];
+
+					u[i + j] = static_cast < std::uint32_t > (carry);
+
+					carry >>= 32;
+				}
+
+				u[j + n] += static_cast < std::uint32_t > (carry);
+			}
+		}
+
+		u.resize(n);
+
+		return { q, shift_right(u, shift) };
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	static auto shift_left(limbs_t const & x, std::size_t shift) -> limbs_t
+	{
+		limbs_t z(std::size(x) + shift / 32 + 1, 0);
+
+		for (auto i = 0uz; i < std::size(x); ++i)
+		{
+			auto t = static_cast < std::uint64_t > (x[i]) << (shift % 32);
+
+			z[i + shift / 32] |= static_cast < std::uint32_t > (t);
+
+			z[i + shift / 32 + 1] |= static_cast < std::uint32_t > (t >> 32);
+		}
+
+		return z;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	static auto shift_right(limbs_t const & x, std::size_t shift) -> limbs_t
+	{
+		limbs_t z(std::size(x) > shift / 32 ? std::size(x) - shift / 32 : 0, 0);
+
+		for (auto i = 0uz; i < std::size(z); ++i)
+		{
+			auto t = static_cast < std::uint64_t > (x[i + shift / 32]);
+
+			if (i + shift / 32 + 1 < std::size(x))
+			{
+				t |= static_cast < std::uint64_t > (x[i + shift / 32 + 1]) << 32;
+			}
+
+			z[i] = static_cast < std::uint32_t > (t >> (shift % 32));
+		}
+
+		return z;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	static auto to_twos_complement(Reference const & x, std::size_t size) -> limbs_t
+	{
+		auto z = x.m_limbs;
+
+		z.resize(size, 0);
+
+		if (x.m_is_negative)
+		{
+			for (auto & limb : z)
+			{
+				limb = ~limb;
+			}
+
+			z = add(z, { 1 });
+
+			z.resize(size);
+		}
+
+		return z;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	template < typename F > static auto bitwise(Reference const & x, Reference const & y, F f) -> Reference
+	{
+		auto size = std::max(std::size(x.m_limbs), std::size(y.m_limbs)) + 1;
+
+		auto a = to_twos_complement(x, size), b = to_twos_complement(y, size);
+
+		for (auto i = 0uz; i < size; ++i)
+		{
+			a[i] = f(a[i], b[i]);
+		}
+
+		auto is_negative = a.back() >> 31;
+
+		if (is_negative)
+		{
+			for (auto & limb : a)
+			{
+				limb = ~limb;
+			}
+
+			a = add(a, { 1 });
+		}
+
+		return Reference(a, is_negative);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	bool m_is_negative = false;
+
+	limbs_t m_limbs;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto make_reference(std::vector < std::uint64_t > const & limbs, bool is_negative)
+{
+	Reference::limbs_t x;
+
+	for (auto limb : limbs)
+	{
+		x.push_back(static_cast < std::uint32_t > (limb));
+
+		x.push_back(static_cast < std::uint32_t > (limb >> 32));
+	}
+
+	return Reference(x, is_negative);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto to_string(Reference const & x) -> std::string
+{
+	return x.to_string();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+class Input
+{
+public :
+
+	Input(std::uint8_t const * data, std::size_t size) : m_data(data), m_size(size) {}
+
+//  ----------------------------------------------------------------------------------------
+
+	auto byte() -> std::uint8_t
+	{
+		return m_offset < m_size ? m_data[m_offset++] : 0;
+	}
+
+	auto word() -> std::uint64_t
+	{
+		std::uint64_t x = 0;
+
+		for (auto i = 0; i < 8; ++i)
+		{
+			x = x << 8 | byte();
+		}
+
+		return x;
+	}
+
+private :
+
+	std::uint8_t const * m_data = nullptr;
+
+	std::size_t m_size = 0, m_offset = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+auto make_limbs(Input & input)
+{
+	constexpr std::size_t sizes[] = { 0, 1, 2, 3, 5, 8, 17, 33, 64, 100, 150, 200 };
+
+	auto kind = input.byte();
+
+	auto size = sizes[kind % std::size(sizes)];
+
+	std::mt19937_64 engine(input.word());
+
+	std::vector < std::uint64_t > limbs(size, 0);
+
+	switch (kind / std::size(sizes) % 5)
+	{
+		case 0:
+		{
+			std::ranges::generate(limbs, engine);
+
+			break;
+		}
+		case 1:
+		{
+			std::ranges::fill(limbs, ~0ull);
+
+			break;
+		}
+		case 2:
+		{
+			limbs.push_back(1);
+
+			break;
+		}
+		case 3:
+		{
+			limbs.push_back(1);
+
+			limbs.front() |= 1;
+
+			break;
+		}
+		default:
+		{
+			for (auto & limb : limbs)
+			{
+				limb = engine() % 2 ? ~0ull : 1ull << engine() % 64;
+			}
+		}
+	}
+
+	return limbs;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void configure(std::uint8_t flags)
+{
+	static auto const defaults = std::tuple
+	(
+		Integer::s_karatsuba_threshold, Integer::s_toom3_threshold, Integer::s_ntt_threshold,
+
+		Integer::s_burnikel_ziegler_threshold, Integer::s_half_gcd_threshold,
+
+		Integer::s_parallel_threshold, Integer::s_threads, Integer::s_kernel
+	);
+
+	std::tie
+	(
+		Integer::s_karatsuba_threshold, Integer::s_toom3_threshold, Integer::s_ntt_threshold,
+
+		Integer::s_burnikel_ziegler_threshold, Integer::s_half_gcd_threshold,
+
+		Integer::s_parallel_threshold, Integer::s_threads, Integer::s_kernel
+	)
+	= defaults;
+
+	if (flags & 0x01) { Integer::s_karatsuba_threshold = 4; }
+
+	if (flags & 0x02) { Integer::s_toom3_threshold = 12; }
+
+	if (flags & 0x04) { Integer::s_ntt_threshold = 24; }
+
+	if (flags & 0x08) { Integer::s_burnikel_ziegler_threshold = 4; }
+
+	if (flags & 0x10) { Integer::s_half_gcd_threshold = 32; }
+
+	if (flags & 0x20) { Integer::s_parallel_threshold = 8; Integer::s_threads = 2; }
+
+	auto kernels = static_cast < int > (Integer::best_kernel()) + 1;
+
+	Integer::s_kernel = static_cast < Integer::Kernel > ((flags >> 6) % kernels);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+class Checker
+{
+public :
+
+	Checker(Reference const & x, Reference const & y) : m_x(to_string(x)), m_y(to_string(y)) {}
+
+//  ----------------------------------------------------------------------------------------
+
+	void operator()(char const * operation, Integer const & result, Reference const & expected) const
+	{
+		if (auto string = result.to_string(); string != to_string(expected))
+		{
+			fail(operation, string, to_string(expected));
+		}
+	}
+
+	void operator()(char const * operation, bool result, bool expected) const
+	{
+		if (result != expected)
+		{
+			fail(operation, std::to_string(result), std::to_string(expected));
+		}
+	}
+
+	void operator()(char const * operation, std::string const & result, std::string const & expected) const
+	{
+		if (result != expected)
+		{
+			fail(operation, result, expected);
+		}
+	}
+
+private :
+
+	[[noreturn]] void fail(char const * operation, std::string const & result, std::string const & expected) const
+	{
+		std::cerr << "mismatch in " << operation << "\nx = " << m_x << "\ny = " << m_y;
+
+		std::cerr << "\nresult   = " << result << "\nexpected = " << expected << '\n';
+
+		std::abort();
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	std::string m_x, m_y;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const * data, std::size_t size)
+{
+	Input input(data, size);
+
+	configure(input.byte());
+
+	auto sign = input.byte();
+
+	auto x = make_reference(make_limbs(input), sign & 1);
+
+	auto y = make_reference(make_limbs(input), sign & 2);
+
+	auto shift = static_cast < std::size_t > (input.byte()) * 3;
+
+	auto word = static_cast < long > (input.word());
+
+	word = word ? word : 1;
+
+	Integer a(to_string(x)), b(to_string(y));
+
+	Checker check(x, y);
+
+	check("parse", a, x);
+
+//  ----------------------------------------------------------------------------------------
+
+	check("+", a + b, x + y);
+
+	check("-", a - b, x - y);
+
+	check("*", a * b, x * y);
+
+	check("- unary", -a, -x);
+
+	check("+ rvalue", Integer(a) + Integer(b), x + y);
+
+	check("- rvalue", a - Integer(b), x - y);
+
+	check("<", a < b, x < y);
+
+	check("==", a == b, x == y);
+
+	check("== self", a == Integer(to_string(x)), true);
+
+	if (b != 0)
+	{
+		check("/", a / b, x / y);
+
+		check("%", a % b, x % y);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto c = a;
+
+		c += b;
+
+		check("+=", c, x + y);
+
+		c *= b;
+
+		check("*=", c, (x + y) * y);
+
+		c -= a;
+
+		check("-=", c, (x + y) * y - x);
+
+		Integer d = lazy(a) * b + a;
+
+		check("lazy", d, x * y + x);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	check("+ word", a + word, x + Reference(word));
+
+	check("- word", a - word, x - Reference(word));
+
+	check("* word", a * word, x * Reference(word));
+
+	check("/ word", a / word, x / Reference(word));
+
+	check("% word", a % word, x % Reference(word));
+
+//  ----------------------------------------------------------------------------------------
+
+	check("<<", a << shift, x << shift);
+
+	check(">>", a >> shift, x >> shift);
+
+	check("&", a & b, x & y);
+
+	check("|", a | b, x | y);
+
+	check("^", a ^ b, x ^ y);
+
+	check("~", ~a, ~x);
+
+//  ----------------------------------------------------------------------------------------
+
+	check("sqrt", sqrt(a.abs()), sqrt(abs(x)));
+
+	check("gcd", gcd(a, b), gcd(x, y));
+
+#if defined(INTEGER_FUZZ_GMP)
+
+	{
+		auto [g, u, v] = xgcd(a, b);
+
+		check("xgcd", g, gcd(x, y));
+
+		check("xgcd bezout", Reference(u.to_string()) * x + Reference(v.to_string()) * y == gcd(x, y), true);
+
+		check("xgcd bound", b == 0 || u.abs() * g * 2 <= b.abs(), true);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	if (b != 0)
+	{
+		auto [is_invertible, inverse] = modinv(x, y);
+
+		try
+		{
+			check("modinv", modinv(a, b), inverse);
+
+			check("modinv exists", true, is_invertible);
+		}
+		catch (std::domain_error const &)
+		{
+			check("modinv exists", false, is_invertible);
+		}
+
+		auto exponent = a.bit_length() * b.bit_length() <= 1uz << 18 ? a.abs() : Integer(word).abs();
+
+		check("powmod", powmod(Integer(word), exponent, b), powmod(Reference(word), Reference(exponent.to_string()), y));
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	if (b != 0)
+	{
+		Rational r(a, b), s(b, Integer(word));
+
+		mpq_class p(x, y), q(y, Reference(word));
+
+		p.canonicalize();
+
+		q.canonicalize();
+
+		check("rational", to_string(r), to_string(p));
+
+		check("rational +", to_string(r + s), to_string(mpq_class(p + q)));
+
+		check("rational -", to_string(r - s), to_string(mpq_class(p - q)));
+
+		check("rational *", to_string(r * s), to_string(mpq_class(p * q)));
+
+		check("rational /", to_string(r / s), to_string(mpq_class(p / q)));
+
+		check("rational <", r < s, p < q);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		using Fixed = FixedInteger < 256 > ;
+
+		Fixed c(a), d(b);
+
+		auto p = wrap < 256 > (x), q = wrap < 256 > (y);
+
+		check("fixed", Integer(c), p);
+
+		check("fixed +", Integer(c + d), wrap < 256 > (p + q));
+
+		check("fixed -", Integer(c - d), wrap < 256 > (p - q));
+
+		check("fixed *", Integer(c * d), wrap < 256 > (p * q));
+
+		check("fixed &", Integer(c & d), Reference(p & q));
+
+		check("fixed |", Integer(c | d), Reference(p | q));
+
+		check("fixed ^", Integer(c ^ d), Reference(p ^ q));
+
+		check("fixed <<", Integer(c << shift), wrap < 256 > (p << shift));
+
+		check("fixed >>", Integer(c >> shift), Reference(p >> shift));
+
+		check("fixed <", c < d, p < q);
+
+		if (q != 0)
+		{
+			check("fixed /", Integer(c / d), wrap < 256 > (p / q));
+
+			check("fixed %", Integer(c % d), Reference(p % q));
+		}
+	}
+
+#endif
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(INTEGER_LIBFUZZER)
+
+int main(int argc, char ** argv)
+{
+	auto iterations = argc > 1 ? std::stoull(argv[1]) : 1'000ull;
+
+	std::mt19937_64 engine(argc > 2 ? std::stoull(argv[2]) : 0);
+
+	std::vector < std::uint8_t > data;
+
+	for (auto i = 0ull; i < iterations; ++i)
+	{
+		data.resize(engine() % 32 + 1);
+
+		for (auto & byte : data)
+		{
+			byte = static_cast < std::uint8_t > (engine());
+		}
+
+		LLVMFuzzerTestOneInput(data.data(), std::size(data));
+	}
+
+	std::cout << iterations << " inputs checked\n";
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// chapter : Number Processing
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// section : Long Arithmetic
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// content : Limb Kernels Benchmark
+//
+// content : Build with -DCMAKE_BUILD_TYPE=Release for meaningful timings
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "task.hpp"
+#include "tools.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+struct KernelBench
+{
+	using digit_t = Integer::digit_t;
+
+	static auto add_n(digit_t * z, digit_t const * x, std::size_t size) { return Integer::add_n(z, x, size); }
+
+	static auto sub_n(digit_t * z, digit_t const * x, std::size_t size) { return Integer::sub_n(z, x, size); }
+
+	static auto compare(digit_t const * x, digit_t const * y, std::size_t size) { return Integer::compare(x, y, size); }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	char const * names[] = { "scalar", "avx2", "avx512" };
+
+	auto best = static_cast < int > (Integer::best_kernel());
+
+	std::cout << std::setw(8) << "limbs" << std::setw(10) << "kernel";
+
+	std::cout << std::setw(16) << "add, us" << std::setw(16) << "subtract, us" << std::setw(16) << "compare, us";
+
+	std::cout << std::setw(16) << "accumulate, us" << '\n';
+
+	for (auto size : { 1'000uz, 10'000uz, 100'000uz, 1'000'000uz })
+	{
+		std::mt19937_64 engine(size);
+
+		std::vector < Integer::digit_t > x(size), y(size);
+
+		std::ranges::generate(x, engine);
+
+		std::ranges::generate(y, engine);
+
+		auto z = y;
+
+		z.front() ^= 1;
+
+		auto w = pow(Integer(2), static_cast < unsigned int > (64 * size - 1)) / 3;
+
+		for (auto i = 0; i <= best; ++i)
+		{
+			Integer::s_kernel = static_cast < Integer::Kernel > (i);
+
+			auto add = measure([&](){ volatile auto carry = KernelBench::add_n(x.data(), y.data(), size); (void)carry; });
+
+			auto subtract = measure([&](){ volatile auto borrow = KernelBench::sub_n(x.data(), y.data(), size); (void)borrow; });
+
+			auto compare = measure([&](){ volatile auto order = KernelBench::compare(y.data(), z.data(), size); (void)order; });
+
+			Accumulator accumulator;
+
+			auto accumulate = measure([&](){ accumulator += w; });
+
+			std::cout << std::setw(8) << size << std::setw(10) << names[i];
+
+			std::cout << std::setw(16) << add << std::setw(16) << subtract << std::setw(16) << compare;
+
+			std::cout << std::setw(16) << accumulate << '\n';
+		}
+	}
+
+	Integer::s_kernel = Integer::best_kernel();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
@@ -13,9 +13,25 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <new>
+#include <ranges>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <system_error>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -23,6 +39,7 @@ using namespace std::literals;
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "allocations.hpp"
 #include "task.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -121,6 +138,818 @@ int main()
 		assert(Integer("0").abs() == Integer("0"));
 	}
 
+//  ----------------------------------------------------------------------------------------
+
+	{
+		std::stringstream stream;
+
+		stream << pow(Integer(10), 10'000);
+
+		assert(stream.str() == '1' + std::string(10'000, '0'));
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		assert((Integer("18446744073709551615") + 1) == "18446744073709551616"s);
+
+		assert((Integer("18446744073709551616") - 1) == "18446744073709551615"s);
+
+		assert((Integer(-5) + 5).sign() == 0);
+
+		std::stringstream stream;
+
+		stream << Integer(-1'000'000'007) * Integer("10000000000000000000");
+
+		assert(stream.str() == "-10000000070000000000000000000");
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(3), 5'000), y = pow(Integer(-7), 3'001);
+
+		auto & k = Integer::s_karatsuba_threshold, & t = Integer::s_toom3_threshold, & n = Integer::s_ntt_threshold;
+
+		auto thresholds = std::tuple(k, t, n);
+
+		std::tie(k, t, n) = std::tuple(1'000'000uz, 1'000'000uz, 1'000'000uz);
+
+		auto z = x * y;
+
+		for (auto [size_1, size_2, size_3] : { std::tuple(4uz, 1'000'000uz, 1'000'000uz), { 5uz, 8uz, 1'000'000uz }, { 4uz, 9uz, 20uz }, { 16uz, 16uz, 1uz } })
+		{
+			std::tie(k, t, n) = std::tuple(size_1, size_2, size_3);
+
+			assert(multiply(x, y) == z && multiply(y, x) == z && x * x * y == z * x);
+		}
+
+		std::tie(k, t, n) = thresholds;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		Integer x("9850501549098619803069760025035903451269934817616361666987888870250024581872001994729580980725666454251825184899073");
+
+		Integer y("57896044618658097705508390768957273163479767643454492530516292286208647626752");
+
+		y = Integer(0) - y;
+
+		auto [q, r] = divmod(x, y);
+
+		assert(q == "-170141183460469231750134047789593657343"s);
+
+		assert(r == "57896044618658097700046808222164731398023884830103120045778230106776336859137"s);
+
+		assert(q * y + r == x && x / y == q && x % y == r);
+
+		[[maybe_unused]] auto is_thrown = false;
+
+		try 
+		{ 
+			x /= 0; 
+		}
+		catch (std::domain_error const &) 
+		{ 
+			is_thrown = true; 
+		}
+
+		assert(is_thrown);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(3), 20'000) - 1, y = pow(Integer(7), 3'000) + 12'345;
+
+		auto threshold = std::exchange(Integer::s_burnikel_ziegler_threshold, 1'000'000uz);
+
+		auto [q, r] = divmod(x, y);
+
+		Integer a = "39402006196394479210143053064222703722916301742770526944201545121951014918455823172967865570042712962298903989759260"s;
+
+		Integer b = "6277101735386680763665648239826425346884932478341694357504"s;
+
+		for (auto size : { 1uz, 2uz, 3uz, 8uz, 33uz })
+		{
+			Integer::s_burnikel_ziegler_threshold = size;
+
+			assert(divmod(x, y) == std::pair(q, r) && divmod(x, x / 5) == std::pair(Integer(5), x % 5));
+
+			assert(a / b == "6277101735386680763665648239667969021888685605283598172163"s);
+		}
+
+		Integer::s_burnikel_ziegler_threshold = threshold;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(3), 20'000), y = pow(Integer(-7), 9'001);
+
+		auto z = x * y;
+
+		auto & k = Integer::s_karatsuba_threshold, & t = Integer::s_toom3_threshold, & n = Integer::s_ntt_threshold;
+
+		auto thresholds = std::tuple(k, t, n, Integer::s_threads, Integer::s_parallel_threshold);
+
+		std::tie(Integer::s_threads, Integer::s_parallel_threshold) = std::tuple(4uz, 8uz);
+
+		for (auto [size_1, size_2, size_3] : { std::tuple(4uz, 1'000'000uz, 1'000'000uz), { 4uz, 9uz, 1'000'000uz }, { 4uz, 9uz, 64uz } })
+		{
+			std::tie(k, t, n) = std::tuple(size_1, size_2, size_3);
+
+			assert(x * y == z && x * x == pow(Integer(3), 40'000));
+		}
+
+		std::tie(k, t, n, Integer::s_threads, Integer::s_parallel_threshold) = thresholds;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(3), 20'000), y = pow(Integer(7), 10'000), z = x * y;
+
+		auto thresholds = std::tuple(Integer::s_threads, Integer::s_parallel_threshold);
+
+		std::tie(Integer::s_threads, Integer::s_parallel_threshold) = std::tuple(4uz, 8uz);
+
+		std::jthread thread([&x, &y, &z]()
+		{
+			for (auto i = 0; i < 16; ++i)
+			{
+				assert(x * y == z);
+			}
+		});
+
+		for (auto i = 0; i < 16; ++i)
+		{
+			assert(x * x == pow(Integer(9), 20'000));
+		}
+
+		thread.join();
+
+		for (auto threads : { 2uz, 3uz, 1uz, 4uz, 2uz })
+		{
+			Integer::s_threads = threads;
+
+			assert(x * x == pow(Integer(9), 20'000) && x * y == z);
+		}
+
+		std::tie(Integer::s_threads, Integer::s_parallel_threshold) = thresholds;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto threads = std::exchange(Integer::s_threads, 1uz);
+
+		auto x = pow(Integer(3), 41'400), y = x * x;
+
+		y = x * x;
+
+		[[maybe_unused]] auto n = allocations.load();
+
+		y = x * x;
+
+		assert(x.bit_length() > 64 * 1'024 && allocations - n == 0 && y == pow(Integer(9), 41'400));
+
+		Integer::s_threads = threads;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(10), 1'001) + 7;
+
+		auto [y, r] = sqrtrem(x);
+
+		assert(y * y + r == x && r >= 0 && r <= y + y);
+
+		assert(sqrt(Integer(0)) == 0 && sqrt(Integer(99)) == 9 && sqrtrem(Integer(100)).second == 0);
+
+		[[maybe_unused]] auto is_thrown = false;
+
+		try 
+		{ 
+			sqrt(Integer(-1)); 
+		}
+		catch (std::domain_error const &) 
+		{ 
+			is_thrown = true; 
+		}
+
+		assert(is_thrown);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		Integer a = std::string(150, '1'), b = std::string(150, '2'), c = std::string(150, '3');
+
+		[[maybe_unused]] auto count = [](auto && f){ auto n = allocations.load(); f(); return allocations - n; };
+
+		assert(count([&](){ auto z = a + b; }) <= 1 && count([&](){ auto z = a + b; }) == 0);
+
+		Integer u = a, v = b, w, z;
+
+		assert(count([&](){ w = std::move(u) + b; }) == 0 && w == a + b);
+
+		assert(count([&](){ z = a - std::move(v); }) == 0 && z == a - b);
+
+		Integer r = lazy(a) * b + c;
+
+		assert(r == a * b + c);
+
+		assert(count([&](){ r = lazy(a) * b + c; }) == 0);
+
+		assert(count([&](){ r = lazy(b) * c - a; }) == 0);
+
+		r = lazy(a) * b - lazy(c) * a;
+
+		assert(r == a * b - c * a);
+
+		assert(count([&](){ r = lazy(c) * b - lazy(b) * a; }) == 0);
+
+		r = lazy(r) * r - r;
+
+		assert(r == (c * b - b * a) * (c * b - b * a) - (c * b - b * a));
+
+		assert((Integer(lazy(a) - b) == a - b) && (Integer((lazy(a) + b) * (lazy(b) - c)) == (a + b) * (b - c)));
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		Integer x = "-18446744073709551616"s;
+
+		assert(x + 1 == "-18446744073709551615"s && 1 - x == "+18446744073709551617"s);
+
+		assert(x * -3 == "+55340232221128654848"s && -3 * x == x * 3uz * -1);
+
+		assert(x / 7 == "-2635249153387078802"s && x % 7 == "-2"s && x / -7 == 0 - x / 7);
+
+		assert(x - std::numeric_limits < long long > ::min() == "-9223372036854775808"s);
+
+		assert(Integer(5) * 0 == 0 && Integer(-5) / 7 == 0 && Integer(-5) % 5 == 0);
+
+		Integer y = std::string(150, '9');
+
+		[[maybe_unused]] auto n = allocations.load();
+
+		for (auto i = 0; i < 1'000; ++i) 
+		{ 
+			++y; 
+		}
+
+		for (auto i = 0; i < 1'000; ++i) 
+		{ 
+			y -= 1; 
+		}
+
+		assert(allocations - n == 0 && y == std::string(150, '9'));
+
+		[[maybe_unused]] auto is_thrown = false;
+
+		try 
+		{ 
+			y /= 0; 
+		}
+		catch (std::domain_error const &) 
+		{ 
+			is_thrown = true; 
+		}
+
+		assert(is_thrown);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		PoolAllocator < Integer::digit_t > allocator;
+
+		[[maybe_unused]] auto is_thrown = false;
+
+		try 
+		{ 
+			allocator.allocate(std::numeric_limits < std::size_t > ::max() / sizeof(Integer::digit_t) + 1); 
+		}
+		catch (std::bad_array_new_length const &) 
+		{ 
+			is_thrown = true; 
+		}
+
+		assert(is_thrown);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto string = "-"s + std::string(1'000, '8') + "12345678901234567890";
+
+		Integer x;
+
+		[[maybe_unused]] auto [end, error] = from_chars(string.data(), string.data() + std::size(string), x);
+
+		assert(error == std::errc() && end == string.data() + std::size(string) && x.to_string() == string);
+
+		char buffer[32] = {};
+
+		assert(to_chars(buffer, buffer + std::size(buffer), x).ec == std::errc::value_too_large);
+
+		[[maybe_unused]] auto result = to_chars(buffer, buffer + std::size(buffer), Integer("-1024"s));
+
+		assert(result.ec == std::errc() && std::string(buffer, result.ptr) == "-1024");
+
+		std::string prefix = "00042abc";
+
+		assert(from_chars(prefix.data(), prefix.data() + std::size(prefix), x).ptr == prefix.data() + 5 && x == 42);
+
+		assert(from_chars(prefix.data() + 5, prefix.data() + std::size(prefix), x).ec == std::errc::invalid_argument);
+
+		assert(Integer(0).to_string() == "0" && Integer("-0"s).to_string() == "0");
+
+		[[maybe_unused]] auto is_thrown = false;
+
+		try 
+		{ 
+			Integer("12x"s); 
+		}
+		catch (std::invalid_argument const &) 
+		{ 
+			is_thrown = true; 
+		}
+
+		assert(is_thrown);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto kernel = Integer::s_kernel;
+
+		auto x = pow(Integer(2), 64 * 37) - 1, y = pow(Integer(3), 1'500), z = x * y;
+
+		for (auto i = 0; i <= static_cast < int > (Integer::best_kernel()); ++i)
+		{
+			Integer::s_kernel = static_cast < Integer::Kernel > (i);
+
+			assert(x + 1 == pow(Integer(2), 64 * 37) && x + 1 - 1 == x && x - x == 0);
+
+			assert(z + x - x == z && z - y + y == z && (z + y) - (z - y) == y * 2);
+
+			assert(x < x + 1 && !(x + 1 < x) && z - 1 < z && z == z * 1 && !(z == z + 1));
+		}
+
+		Integer::s_kernel = kernel;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto p = pow(Integer(2), 127) - 1, q = pow(Integer(2), 521) - 1;
+
+		assert(powmod(Integer(3), Integer("100000000000000000000"), Integer(1'000'000'008)) == 502'611'561);
+
+		assert(powmod(Integer(-5), Integer(12'345), p) == Integer("166603227901996094488990731627184285242"));
+
+		assert(powmod(Integer(7), pow(Integer(2), 64) + 1, q) % 1'000'000'000 == 168'709'511);
+
+		assert(powmod(p - 2, p - 1, p) == 1 && powmod(q + 5, q - 1, q) == 1 && powmod(q, 0, 1) == 0);
+
+		for ([[maybe_unused]] auto exponent : { 0, 1, 2, 3, 7, 8, 31, 100, 257 })
+		{
+			assert(pow(Integer(-3), exponent) == powmod(Integer(-3), exponent, q) - (exponent % 2 ? q : 0));
+		}
+
+		[[maybe_unused]] auto is_thrown = 0;
+
+		try 
+		{ 
+			powmod(p, p, 0); 
+		}
+		catch (std::domain_error const &) 
+		{ 
+			++is_thrown; 
+		}
+
+		try 
+		{ 
+			powmod(p, -1, p); 
+		}
+		catch (std::domain_error const &) 
+		{ 
+			++is_thrown; 
+		}
+
+		assert(is_thrown == 2);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto threshold = Integer::s_half_gcd_threshold;
+
+		auto x = pow(Integer(3), 20'000) * pow(Integer(7), 500), y = pow(Integer(3), 15'000) * pow(Integer(11), 700);
+
+		for (auto size : { threshold, 32uz })
+		{
+			Integer::s_half_gcd_threshold = size;
+
+			assert(gcd(x, y) == pow(Integer(3), 15'000) && gcd(-x, y) == gcd(x, -y) && gcd(x, 0) == x);
+
+			auto [g, u, v] = xgcd(x + 1, y);
+
+			assert(g == gcd(x + 1, y) && u * (x + 1) + v * y == g && (u * 2).abs() * g <= y);
+		}
+
+		Integer::s_half_gcd_threshold = threshold;
+
+		assert(gcd(Integer(0), Integer(0)) == 0 && lcm(Integer(4), Integer(-6)) == 12 && lcm(x, 0) == 0);
+
+		assert(modinv(Integer(3), Integer(7)) == 5 && modinv(Integer(-3), Integer(7)) == 2);
+
+		auto p = pow(Integer(2), 127) - 1;
+
+		assert(modinv(x, p) * x % p == 1);
+
+		[[maybe_unused]] auto is_thrown = false;
+
+		try 
+		{ 
+			modinv(Integer(6), Integer(9)); 
+		}
+		catch (std::domain_error const &) 
+		{ 
+			is_thrown = true; 
+		}
+
+		assert(is_thrown);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		Rational x(Integer(6), Integer(-8)), y(Integer(5), Integer(12));
+
+		assert(x.numerator() == -3 && x.denominator() == 4);
+
+		assert(x + y == Rational(Integer(-1), Integer(3)) && x - y == Rational(Integer(-7), Integer(6)));
+
+		assert(x * y == Rational(Integer(-5), Integer(16)) && x / y == Rational(Integer(-9), Integer(5)));
+
+		assert(x < y && !(y < x) && x + 1 == Rational(Integer(1), Integer(4)));
+
+		std::stringstream stream;
+
+		stream << x << ' ' << x * 4;
+
+		assert(stream.str() == "-3/4 -3");
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(2), 200) + 5, y = -pow(Integer(3), 90);
+
+		assert((x << 70) == x * pow(Integer(2), 70) && (x >> 130) == pow(Integer(2), 70));
+
+		assert((y >> 3) == (y - 7) / 8 && (Integer(-1) >> 100) == -1 && (Integer(-8) >> 3) == -1);
+
+		assert((x & 0xff) == 5 && (y & 7) == 7 && (x | y) == ~(~x & ~y) && (x ^ y) == ((x | y) & ~(x & y)));
+
+		assert((x ^ x) == 0 && (y ^ -1) == ~y && ~Integer(0) == -1 && (y & -1) == y && (x | 0) == x);
+
+		assert(x.bit_length() == 201 && y.bit_length() == 143 && Integer(0).bit_length() == 0);
+
+		assert(x.popcount() == 3 && (x << 64).trailing_zeros() == 64 && Integer(12).trailing_zeros() == 2);
+
+		assert(x.test_bit(200) && !x.test_bit(1) && Integer(-4).test_bit(2) && !Integer(-4).test_bit(1));
+
+		assert(Integer(-4).test_bit(1'000) && !Integer(-4).test_bit(0) && Integer(-3).test_bit(2));
+
+		auto z = x;
+
+		z <<= 1'000;
+
+		z >>= 999;
+
+		assert(z == x * 2 && ((z &= y) |= x) == (((x * 2) & y) | x));
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		using integer_t = FixedInteger < 128 > ;
+
+		constexpr auto x = (integer_t(1) << 127) - 1, y = (integer_t(1) << 61) - 1;
+
+		static_assert(x * y == integer_t("170141183460469231729381460706670411777") && x + 1 < 0);
+
+		static_assert(integer_t(-7) / 2 == -3 && integer_t(-7) % 2 == -1 && (integer_t(-9) >> 1) == -5);
+
+		static_assert((~integer_t(0)) == -1 && (x & y) == y && (x ^ y) == x - y && x.bit_length() == 127);
+
+		auto z = integer_t(1);
+
+		for (auto i = 0; i < 100; ++i)
+		{
+			z *= 3;
+		}
+
+		assert(z == integer_t("137198176105529391099388226870764377041") && z.to_string() == Integer(z).to_string());
+
+		assert(integer_t(pow(Integer(3), 100)) == z && Integer(integer_t(-pow(Integer(2), 100))) == -pow(Integer(2), 100));
+
+		assert(Integer(FixedInteger < 256 > (-pow(Integer(2), 200)) >> 3) == -pow(Integer(2), 197));
+
+		std::stringstream stream;
+
+		stream << z / 1'000'000'000 << ' ' << -z % 1'000'000'000;
+
+		assert(stream.str() == "137198176105529391099388226870 -764377041");
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		Integer const xs[] = { 0, -1, pow(Integer(2), 64), -pow(Integer(3), 1'000), Integer(std::string(500, '9')) };
+
+		std::stringstream stream;
+
+		for (auto const & x : xs)
+		{
+			std::vector < std::byte > buffer(x.serialized_size());
+
+			assert(x.serialize(buffer) == std::size(buffer) && Integer::deserialize(buffer).first == x);
+
+			assert(Integer::deserialize(buffer).second == std::size(buffer));
+
+			x.write(stream);
+		}
+
+		for ([[maybe_unused]] auto const & x : xs)
+		{
+			assert(Integer::read(stream) == x);
+		}
+
+		std::vector < std::byte > buffer(xs[2].serialized_size());
+
+		xs[2].serialize(buffer);
+
+		try { Integer::deserialize(std::span(buffer).first(std::size(buffer) - 1)); assert(false); }
+
+		catch (std::invalid_argument const &) {}
+
+		buffer[0] = std::byte('X');
+
+		try { Integer::deserialize(buffer); assert(false); }
+
+		catch (std::invalid_argument const &) {}
+
+		buffer.resize(xs[3].serialized_size());
+
+		xs[3].serialize(buffer);
+
+		std::ranges::fill(std::span(buffer).subspan(8, 8), std::byte(0));
+
+		buffer[15] = std::byte(0x20);
+
+		std::stringstream corrupted(std::string(reinterpret_cast < char const * > (buffer.data()), std::size(buffer)));
+
+		try { Integer::read(corrupted); assert(false); }
+
+		catch (std::invalid_argument const &) {}
+
+		try { Integer::deserialize(buffer); assert(false); }
+
+		catch (std::invalid_argument const &) {}
+
+#if defined(__unix__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+		auto path = std::filesystem::temp_directory_path() / "task_integer_file.bin";
+
+		{
+			std::ofstream file(path, std::ios::binary);
+
+			for (auto const & x : xs)
+			{
+				x.write(file);
+			}
+		}
+
+		{
+			IntegerFile file(path.string());
+
+			assert(file.size() == std::size(xs) && file[3].is_negative && std::size(file[2].digits) == 2);
+
+			for (auto i = 0uz; i < file.size(); ++i)
+			{
+				assert(file.integer(i) == xs[i]);
+			}
+		}
+
+		std::filesystem::remove(path);
+
+#endif
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(7), 300), y = -pow(Integer(3), 500), z = pow(Integer(2), 3'000) + 1;
+
+		assert(fma(z, x, y) == z + x * y && fma(0, x, y) == x * y && fma(x, 0, y) == x);
+
+		auto w = z;
+
+		assert(w.addmul(x, y) == z + x * y && w.submul(x, y) == z && w.submul(w, w) == z - z * z);
+
+		Integer const xs[] = { x, y, z, 0, -1 }, ys[] = { y, z, x, x, z };
+
+		assert(dot(xs, ys) == x * y + y * z + z * x - z && dot(std::span(xs).first(0), std::span(ys).first(0)) == 0);
+
+		for (auto size : { 3, 40 })
+		{
+			std::vector < Integer > ones(1'000, pow(Integer(2), 64 * size) - 1);
+
+			assert(dot(ones, ones) == ones.front() * ones.front() * 1'000);
+		}
+
+		try { dot(xs, std::span(ys).first(1)); assert(false); } 
+		
+		catch (std::invalid_argument const &) {}
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(2), 640) - 1, y = -pow(Integer(3), 300);
+
+		Accumulator accumulator(x);
+
+		for (auto i = 1; i < 1'000; ++i)
+		{
+			accumulator += x;
+
+			accumulator -= y;
+		}
+
+		assert(accumulator.value() == 1'000 * x - 999 * y);
+
+		accumulator.normalize();
+
+		accumulator -= 1'000 * x;
+
+		assert(Integer(accumulator) == -999 * y && Accumulator().value() == 0);
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(2), 640) - 1, y = pow(Integer(2), 1'000) - 1;
+
+		Accumulator accumulator;
+
+		for (auto i = 0; i < 70'000; ++i)
+		{
+			accumulator += x;
+		}
+
+		assert(accumulator.value() == 70'000 * x);
+
+		auto limit = std::exchange(Accumulator::s_limit, 3uz);
+
+		auto kernel = Integer::s_kernel;
+
+		for (auto i = 0; i <= static_cast < int > (Integer::best_kernel()); ++i)
+		{
+			Integer::s_kernel = static_cast < Integer::Kernel > (i);
+
+			Accumulator accumulator;
+
+			for (auto j = 0; j < 100; ++j)
+			{
+				accumulator += j % 2 ? x : y;
+
+				accumulator -= x;
+			}
+
+			assert(accumulator.value() == 50 * (y - x));
+		}
+
+		Integer::s_kernel = kernel;
+
+		Accumulator::s_limit = limit;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		Integer factorial = 1;
+
+		for (auto i = 1; i <= 1'000; ++i)
+		{
+			factorial *= i;
+		}
+
+		std::vector < Integer > xs = { pow(Integer(2), 500), -pow(Integer(3), 200), 7 };
+
+		std::list < int > ys = { 1, 2, 3, 4, 5 };
+
+		assert(product(std::views::iota(1, 1'001)) == factorial && product(std::vector < int > ()) == 1);
+
+		assert(product(xs) == xs[0] * xs[1] * 7 && product(ys) == 120);
+
+		assert(sum(std::views::iota(1, 1'001)) == 500'500 && sum(xs) == xs[0] + xs[1] + 7 && sum(ys) == 15);
+
+		assert(sum(std::list < Integer > (100, x)) == 100 * x);
+
+		auto threads = std::exchange(Integer::s_threads, 4uz);
+
+		assert(product(std::views::iota(1, 1'001)) == factorial && sum(std::vector < Integer > (10'000, xs[1])) == 10'000 * xs[1]);
+
+		auto thresholds = std::tuple(Integer::s_parallel_threshold, Integer::s_parallel_sum_threshold);
+
+		std::tie(Integer::s_parallel_threshold, Integer::s_parallel_sum_threshold) = std::tuple(8uz, 64uz);
+
+		assert(product(std::views::iota(1, 1'001)) == factorial && sum(std::vector < Integer > (100, x)) == 100 * x);
+
+		assert(sum(std::views::iota(1, 1'001)) == 500'500);
+
+		std::tie(Integer::s_parallel_threshold, Integer::s_parallel_sum_threshold) = thresholds;
+
+		Integer::s_threads = threads;
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(3), 1'000), y = x;
+
+		assert(x.hash() == y.hash() && x.hash() == std::hash < Integer > ()(Integer(x.to_string())));
+
+		y += 1;
+
+		assert(y.hash() != x.hash() && (y - 1).hash() == x.hash() && (-x).hash() != x.hash());
+
+		std::unordered_map < Integer, int, std::hash < Integer > , std::equal_to < > > map;
+
+		for (auto i = -100; i <= 100; ++i)
+		{
+			map[pow(Integer(i), 5)] = i;
+		}
+
+		std::vector < Integer::digit_t > digits = { 32, 0, 0 };
+
+		assert(map.at(Integer(-32)) == -2 && map.find(std::span < Integer::digit_t const > (digits))->second == 2);
+
+		digits.front() = 31;
+
+		assert(!map.contains(std::span < Integer::digit_t const > (digits)) && std::size(map) == 201);
+
+		assert(std::hash < Integer > ()(std::span < Integer::digit_t const > (digits)) == Integer(31).hash());
+
+		assert(Integer::hash({}) == Integer().hash() && std::hash < Integer > ()(IntegerView()) == Integer().hash());
+	}
+
+//  ----------------------------------------------------------------------------------------
+
+	{
+		auto x = pow(Integer(2), 192) + pow(Integer(2), 64) * 3 + 5, y = -pow(Integer(3), 100);
+
+		[[maybe_unused]] IntegerView view = x, low = view.slice(0, 2), high = view.slice(2, 2);
+
+		assert(low == Integer(pow(Integer(2), 64) * 3 + 5) && high == Integer(pow(Integer(2), 64)) && view.slice(5, 1) == IntegerView());
+
+		assert(IntegerView(y) < low && -IntegerView(y) > high && view == x && IntegerView(y) != -IntegerView(y));
+
+		assert(multiply(high, low) == Integer(high) * Integer(low) && Integer(IntegerView(y)) == y);
+
+		auto z = x;
+
+		z += high;
+
+		z -= IntegerView(y);
+
+		assert(z == x + pow(Integer(2), 64) - y && (z *= low) == (x + pow(Integer(2), 64) - y) * Integer(low));
+
+		z = x;
+
+		z += IntegerView(z).slice(1, 3);
+
+		assert(z == x + (x >> 64));
+
+		std::stringstream stream;
+
+		stream << IntegerView(y) << ' ' << high;
+
+		assert(stream.str() == y.to_string() + ' ' + pow(Integer(2), 64).to_string());
+
+		assert(std::hash < Integer > ()(IntegerView(y)) == y.hash() && std::hash < Integer > ()(high) == (x >> 128).hash());
+	}
+
 	return 0;
 }
 
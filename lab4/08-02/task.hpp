@@ -18,15 +18,77 @@
 //
 // content : Arithmetic and Comparison Operators
 //
+// content : Rvalue References and Expression Templates
+//
+// content : Operations with Machine Words
+//
 // content : Operators >> and <<
 //
 // content : Square Roots
 //
+// content : Newton Method for Integer Square Roots
+//
 // content : Karatsuba Fast Multiplication Algorithm
 //
-// content : Functions std::ssize, std::isdigit, std::stoll
+// content : Multiplication over Limb Spans with Scratch Memory
+//
+// content : Toom-Cook 3-Way Multiplication Algorithm
+//
+// content : Number Theoretic Transform and Chinese Remainder Theorem
+//
+// content : Montgomery Modular Multiplication
+//
+// content : Knuth Long Division Algorithm D
+//
+// content : Burnikel-Ziegler Recursive Division Algorithm
+//
+// content : Function std::ssize
 //
 // content : Radix Optimization
+//
+// content : Binary Radix and Divide-and-Conquer Radix Conversion
+//
+// content : Functions std::to_chars and std::from_chars
+//
+// content : SWAR Parsing of Eight Decimal Digits
+//
+// content : Pool Allocator with Size Class Free Lists
+//
+// content : Arena Workspace for Scratch Limbs
+//
+// content : Work Stealing Thread Pool and Parallel Multiplication
+//
+// content : AVX2 and AVX-512 Limb Kernels with Runtime Dispatch
+//
+// content : Sliding Window Exponentiation
+//
+// content : Montgomery and Barrett Modular Reduction
+//
+// content : Binary, Lehmer and Half GCD Algorithms
+//
+// content : Extended Euclidean Algorithm and Modular Inverse
+//
+// content : Rational Numbers
+//
+// content : Bitwise Operators with Two's Complement Semantics
+//
+// content : Shift Operators over Limbs
+//
+// content : Fixed Width Integers with Constexpr Arithmetic
+//
+// content : Binary Serialization Format
+//
+// content : Memory Mapped Files with POSIX mmap
+//
+// content : Fused Multiply Add and Dot Products
+//
+// content : Carry Save Accumulation with Lazy Normalization
+//
+// content : Product Trees and Parallel Reductions over Ranges
+//
+// content : Hashing with Cached Hash Values and Heterogeneous Lookup
+//
+// content : Non-Owning Views over Limb Spans
 
 //////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,558 +96,5993 @@
 
 //////////////////////////////////////////////////////////////////////////////////////////////
 
-#include <cctype>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <charconv>
 #include <cmath>
+#include <compare>
+#include <concepts>
+#include <condition_variable>
 #include <cstddef>
-#include <format>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <istream>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <numeric>
 #include <ostream>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <stop_token>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-//////////////////////////////////////////////////////////////////////////////////////////////
+#if defined(__x86_64__)
 
-class Integer
-{
-public :
+#include <immintrin.h>
 
-	using digit_t = long long int;
+#endif
 
-//  ------------------------------------------------------------------------------------------
+#if defined(__unix__)
 
-	Integer() : m_is_negative(false), m_digits(s_size, 0), m_size(1) {}
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-//  ------------------------------------------------------------------------------------------
+#endif
 
-	Integer(digit_t digit) : Integer() 
-	{ 
-		parse(std::to_string(digit));
-	}
+//////////////////////////////////////////////////////////////////////////////////////////////
 
-//  ------------------------------------------------------------------------------------------
+template < typename T > class PoolAllocator
+{
+public :
 
-	Integer(std::string const & string) : Integer() 
-	{ 
-		parse(string);
-	}
+	using value_type = T;
 
 //  ------------------------------------------------------------------------------------------
 
-	void swap(Integer & other)
-	{
-		std::swap(m_is_negative, other.m_is_negative);
+	PoolAllocator() = default;
 
-		std::swap(m_digits,      other.m_digits     );
-		
-		std::swap(m_size,        other.m_size       );
-	}
+	template < typename U > PoolAllocator(PoolAllocator < U > const &) {}
 
 //  ------------------------------------------------------------------------------------------
 
-	auto & operator+=(Integer other)
+	auto allocate(std::size_t size) -> T *
 	{
-		if (m_is_negative == other.m_is_negative)
-		{
-			this->add(other);
-		}
-		else if (!m_is_negative && other.m_is_negative)
-		{
-			if (this->less(other))
-			{
-				*this = std::move(other.subtract(*this));
-				
-				m_is_negative = true;
-			}
-			else 
-			{
-				this->subtract(other);
-			}
-		}
-		else if (m_is_negative && !other.m_is_negative)
+		if (size > std::numeric_limits < std::size_t > ::max() / sizeof(T))
 		{
-			if (this->less(other))
-			{
-				*this = std::move(other.subtract(*this));
-			}
-			else 
-			{ 
-				this->subtract(other);
-				
-				m_is_negative = true;
-			}
+			throw std::bad_array_new_length();
 		}
 
-		return *this;
-	}
+		auto index = size_class(size);
 
-//  ------------------------------------------------------------------------------------------
+		if (index < s_classes && !s_is_closed && s_lists[index].head)
+		{
+			auto & list = s_lists[index];
 
-	auto & operator-=(Integer other)
-	{
-		other.m_is_negative = !other.m_is_negative;
+			--list.size;
+
+			return reinterpret_cast < T * > (std::exchange(list.head, list.head->next));
+		}
 
-		return *this += other;
+		return static_cast < T * > (::operator new(index < s_classes ? 1uz << index : size * sizeof(T)));
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	auto & operator*=(Integer other)
+	void deallocate(T * pointer, std::size_t size)
 	{
-		Integer x;
-		
-		x.m_is_negative = m_is_negative ^ other.m_is_negative;
+		thread_local guard_t guard;
 
-		for (auto i = 0uz; i < m_size; ++i)
+		if (auto index = size_class(size); index < s_classes && !s_is_closed && s_lists[index].size < s_limit)
 		{
-			digit_t remainder = 0;
+			auto & list = s_lists[index];
 
-			for (auto j = 0uz; (j < other.m_size) || remainder; ++j)
-			{
-				x.m_digits[i + j] += m_digits[i] * other.m_digits[j] + remainder;
-
-				remainder = x.m_digits[i + j] / s_base;
+			++list.size;
 
-				x.m_digits[i + j] -= remainder * s_base;
-			}
+			list.head = ::new (static_cast < void * > (pointer)) node_t { list.head };
+		}
+		else
+		{
+			::operator delete(pointer);
 		}
-
-		x.m_size = m_size + other.m_size;
-
-		swap(x);
-		
-		reduce();
-		
-		return *this;
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	auto & operator/=(Integer other)
-	{
-		Integer x;
-		
-		x.m_size = m_size;
+	friend auto operator==(PoolAllocator const &, PoolAllocator const &) { return true; }
 
-		x.m_is_negative = m_is_negative ^ other.m_is_negative;
-		
-		other.m_is_negative = false;
+private :
 
-		Integer current;
+	struct node_t { node_t * next = nullptr; };
 
-		for (auto i = static_cast < int > (m_size) - 1; i >= 0; --i)
-		{
-			current *= s_base;
-			
-			current.m_digits.front() = m_digits[i];
+	struct list_t { node_t * head = nullptr; std::size_t size = 0; };
 
-			digit_t left = 0, right = s_base, digit = 0;
+//  ------------------------------------------------------------------------------------------
 
-			while (left <= right)
+	struct guard_t
+	{
+	   ~guard_t()
+		{
+			for (auto & list : s_lists)
 			{
-				if (auto middle = std::midpoint(left, right); other * middle <= current)
-				{
-					left  = middle + 1;
-					
-					digit = middle;
-				}
-				else
+				while (list.head)
 				{
-					right = middle - 1;
+					::operator delete(std::exchange(list.head, list.head->next));
 				}
+
+				list.size = 0;
 			}
 
-			x.m_digits[i] = digit;
-			
-			current -= other * digit;
+			s_is_closed = true;
 		}
+	};
 
-		swap(x);
-		
-		reduce();
-		
-		return *this;
+//  ------------------------------------------------------------------------------------------
+
+	static auto size_class(std::size_t size) -> std::size_t
+	{
+		return static_cast < std::size_t > (std::bit_width(std::max(size * sizeof(T), sizeof(node_t)) - 1));
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	auto const operator++(int) { auto x = *this; *this += 1; return x; }
-
-	auto const operator--(int) { auto x = *this; *this -= 1; return x; }
+	static constexpr auto s_classes = 21uz;
 
-//  ------------------------------------------------------------------------------------------
+	static constexpr auto s_limit = 16uz;
 
-	auto & operator++() { *this += 1; return *this; }
+	static inline thread_local list_t s_lists[s_classes] = {};
 
-	auto & operator--() { *this -= 1; return *this; }
+	static inline thread_local auto s_is_closed = false;
+};
 
-//  ------------------------------------------------------------------------------------------
+//////////////////////////////////////////////////////////////////////////////////////////////
 
-	friend auto operator+ (Integer lhs, Integer const & rhs) 			{ return lhs += rhs; }
+template < typename T, std::size_t N, typename A = std::allocator < T > > class SmallVector
+{
+public :
 
-	friend auto operator- (Integer lhs, Integer const & rhs) 			{ return lhs -= rhs; }
+	SmallVector() = default;
 
-	friend auto operator* (Integer lhs, Integer const & rhs) -> Integer { return lhs *= rhs; }
+//  ------------------------------------------------------------------------------------------
 
-	friend auto operator/ (Integer lhs, Integer const & rhs) 			{ return lhs /= rhs; }
+	SmallVector(std::size_t size, T value) 
+	{ 
+		resize(size, value);
+	}
 
 //  ------------------------------------------------------------------------------------------
 
-	friend auto operator< (Integer const & lhs, Integer const & rhs)
+	SmallVector(SmallVector const & other) 
 	{
-		if (lhs.m_is_negative != rhs.m_is_negative)
-		{ 
-			return lhs.m_is_negative; 
-		}
+		reserve(other.m_size);
 
-		if (lhs.m_is_negative && rhs.m_is_negative)
-		{
-			return rhs.less(lhs);
-		}
-		else
-		{
-			return lhs.less(rhs);
-		}
+		std::copy_n(other.m_data, other.m_size, m_data);
+
+		m_size = other.m_size;
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	friend auto operator> (Integer const & lhs, Integer const & rhs)
+	SmallVector(SmallVector && other) noexcept
 	{
-		return  (rhs < lhs);
+		steal(other);
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	friend auto operator<=(Integer const & lhs, Integer const & rhs) -> bool
+   ~SmallVector()
 	{
-		return !(rhs < lhs);
+		release();
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	friend auto operator>=(Integer const & lhs, Integer const & rhs)
+	auto & operator=(SmallVector const & other)
 	{
-		return !(lhs < rhs);
+		if (this != &other)
+		{
+			m_size = 0;
+
+			reserve(other.m_size);
+
+			std::copy_n(other.m_data, other.m_size, m_data);
+
+			m_size = other.m_size;
+		}
+
+		return *this;
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	friend auto operator==(Integer const & lhs, Integer const & rhs) -> bool
+	auto & operator=(SmallVector && other) noexcept
 	{
-		if (lhs.m_is_negative != rhs.m_is_negative || lhs.m_size != rhs.m_size)
+		if (this != &other)
 		{
-			return false;
-		}
+			release();
 
-		for (auto i = 0uz; i < lhs.m_size; ++i)
-		{
-			if (lhs.m_digits[i] != rhs.m_digits[i])
-			{
-				return false;
-			}
+			steal(other);
 		}
 
-		return true;
+		return *this;
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	friend auto & operator>>(std::istream & stream, Integer & integer)
+	void swap(SmallVector & other) noexcept
 	{
-		std::string string;
-		
-		stream >> string;
-		
-		integer = Integer(string);
-		
-		return stream;
+		SmallVector x = std::move(other);
+
+		other = std::move(*this);
+
+		*this = std::move(x);
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	friend auto & operator<<(std::ostream & stream, Integer const & integer)
-	{
-		if (integer.m_is_negative) 
-		{
-			stream << '-';
-		}
+	auto size    () const { return m_size;     }
 
-		stream << integer.m_digits[integer.m_size - 1];
+	auto empty   () const { return m_size == 0; }
 
-		for (auto i = static_cast < int > (integer.m_size) - 2; i >= 0; --i)
-		{
-			stream << std::format("{:0>{}}", integer.m_digits[i], Integer::s_step);
-		}
+	auto capacity() const { return m_capacity; }
 
-		return stream;
-	}
+	auto is_inline() const { return m_data == m_buffer; }
 
 //  ------------------------------------------------------------------------------------------
 
-	friend auto sqrt(Integer const & x)
-	{
-		Integer y;
-		
-		y.m_size = (x.m_size + 1) / 2;
-		
-		for (auto i = static_cast < int > (y.m_size) - 1; i >= 0; --i)
-		{
-			digit_t left = 0, right = Integer::s_base, digit = 0;
+	auto data()       { return m_data; }
 
-			while (left <= right)
-			{
-				auto middle = y.m_digits[i] = std::midpoint(left, right);
+	auto data() const { return static_cast < T const * > (m_data); }
 
-				if (y * y <= x)
-				{
-					left  = middle + 1;
-					
-					digit = std::min(middle, Integer::s_base - 1);
-				}
-				else
-				{
-					right = middle - 1;
-				}				
-			}
+//  ------------------------------------------------------------------------------------------
 
-			y.m_digits[i] = digit;
-		}
+	auto begin()       { return m_data; }
 
-		y.reduce();
-		
-		return y;
-	}
+	auto begin() const { return static_cast < T const * > (m_data); }
 
-//  ------------------------------------------------------------------------------------------
+	auto end  ()       { return m_data + m_size; }
 
-	friend auto multiply(Integer const & x, Integer const & y) -> Integer
-	{
-		if (auto size = std::max(x.m_size, y.m_size); size > 1)
-		{
-			auto step = size / 2;
+	auto end  () const { return static_cast < T const * > (m_data + m_size); }
 
-			Integer x1, x2;
+//  ------------------------------------------------------------------------------------------
 
-			x1.m_size = step;
+	auto & operator[](std::size_t index)       { return m_data[index]; }
 
-			x2.m_size = size - step;
+	auto & operator[](std::size_t index) const { return m_data[index]; }
 
-			for (auto i =  0uz; i < step; ++i) { x1.m_digits[i       ] = x.m_digits[i]; }
+//  ------------------------------------------------------------------------------------------
 
-			for (auto i = step; i < size; ++i) { x2.m_digits[i - step] = x.m_digits[i]; }
+	auto & front()       { return m_data[0]; }
 
-			Integer y1, y2;
+	auto & front() const { return m_data[0]; }
 
-			y1.m_size = step;
-			
-			y2.m_size = size - step;
+	auto & back ()       { return m_data[m_size - 1]; }
 
-			for (auto i =  0uz; i < step; ++i) { y1.m_digits[i       ] = y.m_digits[i]; }
+	auto & back () const { return m_data[m_size - 1]; }
 
-			for (auto i = step; i < size; ++i) { y2.m_digits[i - step] = y.m_digits[i]; }
+//  ------------------------------------------------------------------------------------------
 
-			auto a = multiply(x2, y2);
-			
-			auto b = multiply(x1, y1);
-			
-			auto c = multiply(x2 + x1, y2 + y1);
+	void reserve(std::size_t capacity)
+	{
+		if (capacity > m_capacity)
+		{
+			capacity = std::max(capacity, m_capacity * 2);
 
-			Integer base = Integer::s_base;
+			auto data = std::allocator_traits < A > ::allocate(m_allocator, capacity);
 
-			for (auto i = 1uz; i < step; ++i)
-			{
-				base *= Integer::s_base;
-			}
+			std::uninitialized_default_construct_n(data, capacity);
 
-			auto z = a * base * base + (c - b - a) * base + b;
+			std::copy_n(m_data, m_size, data);
 
-			z.m_is_negative = x.m_is_negative ^ y.m_is_negative;
+			release();
 
-			return z;
-		}
-		else
-		{
-			return x * y;
+			m_data = data;
+			
+			m_capacity = capacity;
 		}
 	}
 
-// ---------- remainder, sign, absolute value ---------------------------------------
+//  ------------------------------------------------------------------------------------------
 
-	Integer& operator%=(const Integer& other)
+	void resize(std::size_t size, T value = T())
 	{
-		*this = *this - (*this / other) * other;
-		return *this;
-	}
+		reserve(size);
 
-	int sign() const
-	{
-		if (*this == Integer(0)) return 0;
-		return m_is_negative ? -1 : 1;
+		if (size > m_size)
+		{
+			std::fill(m_data + m_size, m_data + size, value);
+		}
+
+		m_size = size;
 	}
 
-	Integer abs() const
+//  ------------------------------------------------------------------------------------------
+
+	void push_back(T value)
 	{
-		if (sign() < 0)
-		{
-			Integer result = *this;
-			result.m_is_negative = false;
-			return result;
-		}
-		return *this;
+		reserve(m_size + 1);
+
+		m_data[m_size++] = value;
 	}
 
-	friend Integer operator%(const Integer& lhs, const Integer& rhs);
-	friend Integer pow(const Integer& base, unsigned int exp);
+//  ------------------------------------------------------------------------------------------
+
+	void pop_back() { --m_size; }
+
+	void clear   () { m_size = 0; }
 
 private :
 
-	void parse(std::string const & string)
+	void steal(SmallVector & other)
 	{
-		m_is_negative = string.front() == '-';
-			
-		m_size = 0;
-
-		for (auto i = std::ssize(string) - 1; i >= 0; i -= s_step)
+		if (other.is_inline())
 		{
-			auto begin = std::max(i - s_step + 1, 0l);
+			std::copy_n(other.m_buffer, other.m_size, m_buffer);
 
-			if (begin == 0 && !std::isdigit(string.front()))
-			{
-				++begin;
-			}
+			m_data = m_buffer;
 
-			auto digit = string.substr(begin, i - begin + 1);
+			m_capacity = N;
+		}
+		else
+		{
+			m_data = std::exchange(other.m_data, other.m_buffer);
 
-			if (std::size(digit) > 0)
-			{
-				m_digits[m_size++] = std::stoll(digit);
-			}
+			m_capacity = std::exchange(other.m_capacity, N);
 		}
 
-		reduce();
+		m_size = std::exchange(other.m_size, 0);
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	void reduce()
+	void release()
 	{
-		while (m_size > 1 && !m_digits[m_size - 1]) 
+		if (!is_inline())
 		{
-			--m_size;
+			std::destroy_n(m_data, m_capacity);
+
+			std::allocator_traits < A > ::deallocate(m_allocator, m_data, m_capacity);
+
+			m_data = m_buffer;
+
+			m_capacity = N;
 		}
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	auto add(Integer const & other) -> Integer &
-	{
-		m_size = std::max(m_size, other.m_size);
+	T m_buffer[N] = {};
 
-		for (auto i = 0uz; i < m_size; ++i)
-		{
-			m_digits[i] += other.m_digits[i];
+	T * m_data = m_buffer;
 
-			if (m_digits[i] >= s_base)
-			{
-				m_digits[i] -= s_base;
+	std::size_t m_size = 0;
+
+	std::size_t m_capacity = N;
+
+	[[no_unique_address]] A m_allocator;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class ThreadPool
+{
+public :
+
+	explicit ThreadPool(std::size_t size) : m_queues(std::max(size, 1uz))
+	{
+		for (auto i = 1uz; i < std::size(m_queues); ++i)
+		{
+			m_threads.emplace_back([this, i](std::stop_token token){ work(token, i); });
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto size() const { return std::size(m_queues); }
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto current() -> ThreadPool * { return s_pool; }
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename F > void run(std::size_t count, F const & f)
+	{
+		std::atomic < std::size_t > remaining = count;
+
+		std::exception_ptr exception;
+
+		std::mutex mutex;
+
+		auto execute = [&](std::size_t i)
+		{
+			try
+			{
+				f(i);
+			}
+			catch (...)
+			{
+				std::scoped_lock lock(mutex);
+
+				if (!exception)
+				{
+					exception = std::current_exception();
+				}
+			}
+
+			remaining.fetch_sub(1, std::memory_order_release);
+		};
+
+		auto index = s_pool == this ? s_index : 0;
+
+		auto previous = std::pair(std::exchange(s_pool, this), std::exchange(s_index, index));
+
+		for (auto i = count; i-- > 1;)
+		{
+			push(index, [&execute, i](){ execute(i); });
+		}
+
+		if (count > 0)
+		{
+			execute(0);
+		}
+
+		while (remaining.load(std::memory_order_acquire) > 0)
+		{
+			if (!pop(index))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		std::tie(s_pool, s_index) = previous;
+
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+
+private :
+
+	void push(std::size_t index, std::function < void() > task)
+	{
+		{
+			std::scoped_lock lock(m_mutex);
+
+			++m_pending;
+
+			std::scoped_lock queue_lock(m_queues[index].mutex);
+
+			m_queues[index].tasks.push_back(std::move(task));
+		}
+
+		m_condition.notify_one();
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto pop(std::size_t index) -> bool
+	{
+		std::function < void() > task;
+
+		for (auto i = 0uz; i < std::size(m_queues) && !task; ++i)
+		{
+			auto & queue = m_queues[(index + i) % std::size(m_queues)];
+
+			std::scoped_lock lock(queue.mutex);
+
+			if (!std::empty(queue.tasks))
+			{
+				if (i == 0)
+				{
+					task = std::move(queue.tasks.back()); queue.tasks.pop_back();
+				}
+				else
+				{
+					task = std::move(queue.tasks.front()); queue.tasks.pop_front();
+				}
+			}
+		}
+
+		if (!task)
+		{
+			return false;
+		}
+
+		{
+			std::scoped_lock lock(m_mutex);
+
+			--m_pending;
+		}
+
+		task();
+
+		return true;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void work(std::stop_token token, std::size_t index)
+	{
+		s_pool = this;
+
+		s_index = index;
+
+		while (!token.stop_requested())
+		{
+			if (!pop(index))
+			{
+				std::unique_lock lock(m_mutex);
+
+				m_condition.wait(lock, token, [this](){ return m_pending > 0; });
+			}
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	struct queue_t 
+	{ 
+		std::mutex mutex; 
+		
+		std::deque < std::function < void() > > tasks; 
+	};
+
+//  ------------------------------------------------------------------------------------------
+
+	std::vector < queue_t > m_queues;
+
+	std::mutex m_mutex;
+
+	std::condition_variable_any m_condition;
+
+	std::size_t m_pending = 0;
+
+	std::vector < std::jthread > m_threads;
+
+//  ------------------------------------------------------------------------------------------
+
+	static inline thread_local ThreadPool * s_pool = nullptr;
+
+	static inline thread_local std::size_t s_index = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class Integer;
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < typename R > concept integer_range = std::ranges::input_range < R > && 
+	
+	(std::same_as < std::ranges::range_value_t < R > , Integer > || std::integral < std::ranges::range_value_t < R > > );
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class IntegerView
+{
+public :
+
+	using digit_t = unsigned long long int;
+
+//  ------------------------------------------------------------------------------------------
+
+	IntegerView() = default;
+
+	IntegerView(Integer const & x);
+
+	explicit IntegerView(std::span < digit_t const > digits, bool is_negative = false) 
+	: 
+		m_digits(trim(digits)), m_is_negative(is_negative && !std::empty(m_digits)) 
+	{}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto is_negative() const { return m_is_negative; }
+
+	auto digits() const { return m_digits; }
+
+	auto size() const { return std::size(m_digits); }
+
+//  ------------------------------------------------------------------------------------------
+
+	auto bit_length() const -> std::size_t
+	{
+		if (std::empty(m_digits))
+		{
+			return 0;
+		}
+
+		return std::size(m_digits) * std::numeric_limits < digit_t > ::digits - std::countl_zero(m_digits.back());
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto slice(std::size_t begin, std::size_t size) const
+	{
+		begin = std::min(begin, std::size(m_digits));
+
+		return IntegerView(m_digits.subspan(begin, std::min(size, std::size(m_digits) - begin)));
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto abs() const { return IntegerView(m_digits); }
+
+	friend auto operator-(IntegerView x) { return IntegerView(x.m_digits, !x.m_is_negative); }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator== (IntegerView const & lhs, IntegerView const & rhs) -> bool;
+
+	friend auto operator<=>(IntegerView const & lhs, IntegerView const & rhs) -> std::strong_ordering;
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator<<(std::ostream & stream, IntegerView const & x) -> std::ostream &;
+
+	auto to_string() const -> std::string;
+
+private :
+
+	static auto trim(std::span < digit_t const > x) -> std::span < digit_t const >
+	{
+		while (!std::empty(x) && !x.back())
+		{
+			x = x.first(std::size(x) - 1);
+		}
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto compare(IntegerView const & x, IntegerView const & y) -> int;
+
+//  ------------------------------------------------------------------------------------------
+
+	std::span < digit_t const > m_digits;
+
+	bool m_is_negative = false;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Lazy
+{
+	auto contains(Integer const & x) const { return &value == &x; }
+
+//  ------------------------------------------------------------------------------------------
+
+	Integer const & value;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < typename L, typename R, char O > struct Expression
+{
+	auto contains(Integer const & x) const { return lhs.contains(x) || rhs.contains(x); }
+
+//  ------------------------------------------------------------------------------------------
+
+	L lhs; R rhs;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < typename T > constexpr auto is_expression_v = false;
+
+template <> constexpr auto is_expression_v < Lazy > = true;
+
+template < typename L, typename R, char O > constexpr auto is_expression_v < Expression < L, R, O > > = true;
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class Integer
+{
+public :
+
+	using digit_t = unsigned long long int;
+
+	__extension__ using wide_t = unsigned __int128;
+
+//  ------------------------------------------------------------------------------------------
+
+	static inline auto s_karatsuba_threshold = 32uz;
+
+	static inline auto s_toom3_threshold = 1'280uz;
+
+	static inline auto s_ntt_threshold = 2'560uz;
+
+	static inline auto s_burnikel_ziegler_threshold = 96uz;
+
+	static inline auto s_half_gcd_threshold = 2'048uz;
+
+	static inline auto s_parallel_threshold = 2'048uz;
+
+	static inline auto s_parallel_sum_threshold = 65'536uz;
+
+	static inline auto s_threads = static_cast < std::size_t > (std::max(std::thread::hardware_concurrency(), 1u));
+
+//  ------------------------------------------------------------------------------------------
+
+	enum class Kernel { scalar, avx2, avx512 };
+
+	static auto best_kernel() -> Kernel
+	{
+#if defined(__x86_64__)
+
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx512f"))
+		{
+			return Kernel::avx512;
+		}
+
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return Kernel::avx2;
+		}
+
+#endif
+
+		return Kernel::scalar;
+	}
+
+	static inline auto s_kernel = best_kernel();
+
+//  ------------------------------------------------------------------------------------------
+
+	class Workspace
+	{
+	public :
+
+		class Frame
+		{
+		public :
+
+			Frame(Workspace & workspace) : m_workspace(workspace), m_block(workspace.m_block), m_offset(workspace.m_offset) {}
+
+		   ~Frame()
+			{
+				m_workspace.m_block = m_block;
+
+				m_workspace.m_offset = m_offset;
+			}
+
+			Frame(Frame const &) = delete;
+
+			auto operator=(Frame const &) -> Frame & = delete;
+
+		private :
+
+			Workspace & m_workspace;
+
+			std::size_t m_block = 0, m_offset = 0;
+		};
+
+	//  --------------------------------------------------------------------------------------
+
+		class Scope
+		{
+		public :
+
+			Scope(Workspace & workspace) : m_previous(std::exchange(s_current, &workspace)) {}
+
+		   ~Scope()
+			{
+				s_current = m_previous;
+			}
+
+			Scope(Scope const &) = delete;
+
+			auto operator=(Scope const &) -> Scope & = delete;
+
+		private :
+
+			Workspace * m_previous = nullptr;
+		};
+
+	//  --------------------------------------------------------------------------------------
+
+		Workspace() = default;
+
+		Workspace(Workspace const &) = delete;
+
+		auto operator=(Workspace const &) -> Workspace & = delete;
+
+	//  --------------------------------------------------------------------------------------
+
+		auto allocate(std::size_t size) -> std::span < digit_t >
+		{
+			while (m_block < std::size(m_blocks) && std::size(m_blocks[m_block]) - m_offset < size)
+			{
+				++m_block;
+
+				m_offset = 0;
+			}
+
+			if (m_block == std::size(m_blocks))
+			{
+				auto capacity = std::empty(m_blocks) ? 0uz : 2 * std::size(m_blocks.back());
+
+				m_blocks.emplace_back(std::max({ size, capacity, 1'024uz }), 0);
+			}
+
+			std::span < digit_t > span(m_blocks[m_block].data() + m_offset, size);
+
+			std::ranges::fill(span, 0);
+
+			m_offset += size;
+
+			return span;
+		}
+
+	//  --------------------------------------------------------------------------------------
+
+		static auto current() -> Workspace &
+		{
+			thread_local Workspace workspace;
+
+			return s_current ? *s_current : workspace;
+		}
+
+	private :
+
+		std::vector < std::vector < digit_t > > m_blocks;
+
+		std::size_t m_block = 0, m_offset = 0;
+
+		static inline thread_local Workspace * s_current = nullptr;
+	};
+
+//  ------------------------------------------------------------------------------------------
+
+	Integer() : m_is_negative(false), m_digits(1, 0) {}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::integral T > Integer(T value) : Integer() 
+	{ 
+		m_is_negative = value < 0;
+
+		m_digits.front() = static_cast < digit_t > (value);
+
+		if (m_is_negative)
+		{
+			m_digits.front() = 0 - m_digits.front();
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	Integer(std::string const & string) : Integer() 
+	{ 
+		parse(string);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	explicit Integer(IntegerView const & x) : Integer() 
+	{ 
+		if (!std::empty(x.digits()))
+		{
+			m_digits.resize(std::size(x.digits()));
+
+			std::ranges::copy(x.digits(), m_digits.begin());
+
+			m_is_negative = x.is_negative();
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename E > requires is_expression_v < E > Integer(E const & expression) : Integer()
+	{
+		assign(expression);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename E > requires is_expression_v < E > auto & operator=(E const & expression)
+	{
+		assign(expression);
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void swap(Integer & other)
+	{
+		std::swap(m_is_negative, other.m_is_negative);
+
+		m_digits.swap(other.m_digits);
+
+		m_hash.value.store(0, std::memory_order_relaxed);
+
+		other.m_hash.value.store(0, std::memory_order_relaxed);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator+=(Integer const & other)
+	{
+		return add(other, other.m_is_negative);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator+=(Integer && other)
+	{
+		if (other.m_digits.capacity() > m_digits.capacity())
+		{
+			swap(other);
+		}
+
+		return add(other, other.m_is_negative);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator-=(Integer const & other)
+	{
+		return add(other, !other.m_is_negative);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator-=(Integer && other)
+	{
+		other.m_is_negative = !other.m_is_negative;
+
+		return *this += std::move(other);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator*=(Integer const & other)
+	{
+		*this = multiply(*this, other);
+		
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator+=(IntegerView const & other) { return add(other, other.is_negative()); }
+
+	auto & operator-=(IntegerView const & other) { return add(other, !other.is_negative()); }
+
+	auto & operator*=(IntegerView const & other) { return *this = multiply(*this, other); }
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator/=(Integer const & other)
+	{
+		*this = std::move(divmod(*this, other).first);
+		
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator%=(Integer const & other)
+	{
+		*this = std::move(divmod(*this, other).second);
+		
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::integral T > auto & operator+=(T value)
+	{
+		return add_small(magnitude(value), value < 0);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::integral T > auto & operator-=(T value)
+	{
+		return add_small(magnitude(value), !(value < 0));
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::integral T > auto & operator*=(T value)
+	{
+		mul_add_small(magnitude(value), 0);
+
+		m_is_negative ^= value < 0;
+
+		reduce();
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::integral T > auto & operator/=(T value)
+	{
+		divmod_small(magnitude(value));
+
+		m_is_negative ^= value < 0;
+
+		reduce();
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::integral T > auto & operator%=(T value)
+	{
+		auto is_negative = m_is_negative;
+
+		*this = divmod_small(magnitude(value));
+
+		m_is_negative = is_negative;
+
+		reduce();
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto const operator++(int) { auto x = *this; *this += 1; return x; }
+
+	auto const operator--(int) { auto x = *this; *this -= 1; return x; }
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator++() { *this += 1; return *this; }
+
+	auto & operator--() { *this -= 1; return *this; }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator- (Integer x) { x.m_is_negative = !x.m_is_negative; x.reduce(); return x; }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator+ (Integer lhs, Integer const & rhs) 		  { return std::move(lhs += rhs); }
+
+	friend auto operator+ (Integer const & lhs, Integer && rhs) 	  { return std::move(rhs += lhs); }
+
+	friend auto operator- (Integer lhs, Integer const & rhs) 		  { return std::move(lhs -= rhs); }
+
+	friend auto operator- (Integer const & lhs, Integer && rhs) 	  { return -std::move(rhs -= lhs); }
+
+	friend auto operator* (Integer const & lhs, Integer const & rhs) { return multiply(lhs, rhs); }
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::integral T > friend auto operator+(Integer lhs, T rhs) { return std::move(lhs += rhs); }
+
+	template < std::integral T > friend auto operator+(T lhs, Integer rhs) { return std::move(rhs += lhs); }
+
+	template < std::integral T > friend auto operator-(Integer lhs, T rhs) { return std::move(lhs -= rhs); }
+
+	template < std::integral T > friend auto operator*(Integer lhs, T rhs) { return std::move(lhs *= rhs); }
+
+	template < std::integral T > friend auto operator*(T lhs, Integer rhs) { return std::move(rhs *= lhs); }
+
+	template < std::integral T > friend auto operator/(Integer lhs, T rhs) { return std::move(lhs /= rhs); }
+
+	template < std::integral T > friend auto operator%(Integer lhs, T rhs) { return std::move(lhs %= rhs); }
+
+
+	friend auto operator/ (Integer const & lhs, Integer const & rhs) { return divmod(lhs, rhs).first; }
+
+	friend auto operator% (Integer const & lhs, Integer const & rhs) { return divmod(lhs, rhs).second; }
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator<<=(std::size_t shift)
+	{
+		auto is_negative = m_is_negative;
+
+		*this = shift_left(shift);
+
+		m_is_negative = is_negative;
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator>>=(std::size_t shift)
+	{
+		auto is_negative = m_is_negative, is_inexact = m_is_negative && trailing_zeros() < shift;
+
+		*this = shift_right(shift);
+
+		m_is_negative = is_negative;
+
+		reduce();
+
+		if (is_inexact)
+		{
+			*this -= 1;
+		}
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator&=(Integer const & other) { return *this = bitwise(*this, other, std::bit_and < > ()); }
+
+	auto & operator|=(Integer const & other) { return *this = bitwise(*this, other, std::bit_or  < > ()); }
+
+	auto & operator^=(Integer const & other) { return *this = bitwise(*this, other, std::bit_xor < > ()); }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator<<(Integer lhs, std::size_t shift) { return std::move(lhs <<= shift); }
+
+	friend auto operator>>(Integer lhs, std::size_t shift) { return std::move(lhs >>= shift); }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator~ (Integer x) { return -std::move(x) - 1; }
+
+	friend auto operator& (Integer const & lhs, Integer const & rhs) { return bitwise(lhs, rhs, std::bit_and < > ()); }
+
+	friend auto operator| (Integer const & lhs, Integer const & rhs) { return bitwise(lhs, rhs, std::bit_or  < > ()); }
+
+	friend auto operator^ (Integer const & lhs, Integer const & rhs) { return bitwise(lhs, rhs, std::bit_xor < > ()); }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator< (Integer const & lhs, Integer const & rhs)
+	{
+		if (lhs.m_is_negative != rhs.m_is_negative)
+		{ 
+			return lhs.m_is_negative; 
+		}
+
+		if (lhs.m_is_negative && rhs.m_is_negative)
+		{
+			return rhs.less(lhs);
+		}
+		else
+		{
+			return lhs.less(rhs);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator> (Integer const & lhs, Integer const & rhs)
+	{
+		return  (rhs < lhs);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator<=(Integer const & lhs, Integer const & rhs) -> bool
+	{
+		return !(rhs < lhs);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator>=(Integer const & lhs, Integer const & rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator==(Integer const & lhs, Integer const & rhs) -> bool
+	{
+		return lhs.m_is_negative == rhs.m_is_negative && std::size(lhs.m_digits) == std::size(rhs.m_digits) &&
+
+			compare(lhs.m_digits.data(), rhs.m_digits.data(), std::size(lhs.m_digits)) == 0;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator==(Integer const & lhs, std::span < digit_t const > rhs) -> bool
+	{
+		return IntegerView(lhs) == IntegerView(rhs);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto hash() const -> std::size_t
+	{
+		auto value = m_hash.value.load(std::memory_order_relaxed);
+
+		if (!value)
+		{
+			value = hash(digits(), m_is_negative);
+
+			m_hash.value.store(value, std::memory_order_relaxed);
+		}
+
+		return value;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto hash(std::span < digit_t const > digits, bool is_negative = false) -> std::size_t
+	{
+		digits = IntegerView(digits).digits();
+
+		auto size = std::size(digits), i = 0uz;
+
+		digit_t lanes[4] = { s_seeds[0], s_seeds[1], s_seeds[2], s_seeds[3] };
+
+		for (; i + 8 <= size; i += 8)
+		{
+			for (auto j = 0uz; j < 4; ++j)
+			{
+				lanes[j] = mix(digits[i + 2 * j] ^ s_seeds[j], digits[i + 2 * j + 1] ^ lanes[j]);
+			}
+		}
+
+		for (; i + 2 <= size; i += 2)
+		{
+			lanes[0] = mix(digits[i] ^ s_seeds[1], digits[i + 1] ^ lanes[0]);
+		}
+
+		auto x = lanes[0] ^ lanes[1] ^ lanes[2] ^ lanes[3];
+
+		auto y = (i < size ? digits[i] : 0) ^ s_seeds[2];
+
+		auto value = static_cast < std::size_t > (mix(x ^ s_seeds[3] ^ is_negative, mix(y, size ^ s_seeds[0])));
+
+		return std::max(value, 1uz);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto & operator>>(std::istream & stream, Integer & integer)
+	{
+		std::string string;
+		
+		stream >> string;
+		
+		integer = Integer(string);
+		
+		return stream;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto & operator<<(std::ostream & stream, Integer const & integer)
+	{
+		return stream << integer.to_string();
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto to_string() const -> std::string
+	{
+		std::string string(1 + (bit_length() / (s_bits - 1) + 1) * s_step, '\0');
+
+		auto [end, error] = print(string.data(), string.data() + std::size(string), *this);
+
+		string.resize(static_cast < std::size_t > (end - string.data()));
+
+		return string;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto to_chars(char * first, char * last, Integer const & x) -> std::to_chars_result
+	{
+		return print(first, last, x);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto from_chars(char const * first, char const * last, Integer & x) -> std::from_chars_result
+	{
+		auto begin = first != last && *first == '-' ? first + 1 : first;
+
+		auto end = std::find_if(begin, last, [](auto c){ return c < '0' || c > '9'; });
+
+		if (begin == end)
+		{
+			return { first, std::errc::invalid_argument };
+		}
+
+		std::vector < digit_t > chunks((static_cast < std::size_t > (end - begin) + s_step - 1) / s_step);
+
+		auto position = end;
+
+		for (auto & chunk : chunks)
+		{
+			auto size = std::min(static_cast < std::ptrdiff_t > (s_step), position - begin);
+
+			position -= size;
+
+			chunk = parse_chunk(position, static_cast < std::size_t > (size));
+		}
+
+		std::vector < Integer > powers;
+
+		x = convert(chunks.data(), std::size(chunks), powers);
+
+		x.m_is_negative = begin != first;
+
+		x.reduce();
+
+		return { end, std::errc() };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto sqrt(Integer const & x)
+	{
+		return sqrtrem(x).first;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto sqrtrem(Integer const & x) -> std::pair < Integer, Integer >
+	{
+		if (x.m_is_negative)
+		{
+			throw std::domain_error("square root of negative number");
+		}
+
+		auto y = sqrt_newton(x);
+
+		auto r = x - y * y;
+
+		return { std::move(y), std::move(r) };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto multiply(Integer const & x, Integer const & y) -> Integer
+	{
+		Integer z;
+
+		z.assign_product(x, y);
+
+		return z;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto multiply(IntegerView const & x, IntegerView const & y) -> Integer
+	{
+		Integer z;
+
+		z.assign_product(x, y);
+
+		return z;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto multiply(Integer const & x, Integer const & y, Workspace & workspace) -> Integer
+	{
+		Workspace::Scope scope(workspace);
+
+		return multiply(x, y);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & addmul(Integer const & x, Integer const & y)
+	{
+		return add_product(x, y, x.m_is_negative ^ y.m_is_negative);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & submul(Integer const & x, Integer const & y)
+	{
+		return add_product(x, y, !(x.m_is_negative ^ y.m_is_negative));
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto fma(Integer accumulator, Integer const & x, Integer const & y)
+	{
+		return std::move(accumulator.addmul(x, y));
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto dot(std::span < Integer const > x, std::span < Integer const > y) -> Integer
+	{
+		if (std::size(x) != std::size(y))
+		{
+			throw std::invalid_argument("size mismatch");
+		}
+
+		auto size = 0uz;
+
+		for (auto i = 0uz; i < std::size(x); ++i)
+		{
+			size = std::max(size, std::size(x[i].m_digits) + std::size(y[i].m_digits));
+		}
+
+		auto & workspace = Workspace::current();
+
+		Workspace::Frame frame(workspace);
+
+		std::span < digit_t > sums[2], carries[2];
+
+		for (auto k = 0uz; k < 2; ++k)
+		{
+			sums[k] = workspace.allocate(size + 1);
+
+			carries[k] = workspace.allocate(size + 1);
+		}
+
+		for (auto i = 0uz; i < std::size(x); ++i)
+		{
+			if (x[i] != 0 && y[i] != 0)
+			{
+				auto k = x[i].m_is_negative ^ y[i].m_is_negative;
+
+				add_product_carry_save(sums[k], carries[k], x[i].digits(), y[i].digits());
+			}
+		}
+
+		for (auto k = 0uz; k < 2; ++k)
+		{
+			add_to(sums[k], carries[k]);
+		}
+
+		auto z = Integer(IntegerView(sums[0]));
+
+		return std::move(z -= IntegerView(sums[1]));
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto divmod(Integer const & x, Integer const & y) -> std::pair < Integer, Integer >
+	{
+		if (std::size(y.m_digits) == 1 && !y.m_digits.front())
+		{
+			throw std::domain_error("division by zero");
+		}
+
+		auto [q, r] = std::size(y.m_digits) >= burnikel_ziegler_threshold() &&
+
+			std::size(x.m_digits) >= std::size(y.m_digits) + burnikel_ziegler_threshold() ? 
+			
+			divmod_burnikel_ziegler(x, y) : divmod_knuth(x, y);
+
+		q.m_is_negative = x.m_is_negative ^ y.m_is_negative;
+
+		r.m_is_negative = x.m_is_negative;
+
+		q.reduce();
+
+		r.reduce();
+
+		return { std::move(q), std::move(r) };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto divmod(Integer const & x, Integer const & y, Workspace & workspace) -> std::pair < Integer, Integer >
+	{
+		Workspace::Scope scope(workspace);
+
+		return divmod(x, y);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void mul_add_small(digit_t factor, digit_t addend)
+	{
+		for (auto & digit : m_digits)
+		{
+			auto x = static_cast < wide_t > (digit) * factor + addend;
+
+			digit = static_cast < digit_t > (x);
+
+			addend = static_cast < digit_t > (x >> s_bits);
+		}
+
+		if (addend)
+		{
+			m_digits.push_back(addend);
+		}
+
+		reduce();
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto divmod_small(digit_t divisor) -> digit_t
+	{
+		if (!divisor)
+		{
+			throw std::domain_error("division by zero");
+		}
+
+		wide_t remainder = 0;
+
+		for (auto i = std::ssize(m_digits) - 1; i >= 0; --i)
+		{
+			auto x = remainder << s_bits | m_digits[i];
+
+			m_digits[i] = static_cast < digit_t > (x / divisor);
+
+			remainder = x % divisor;
+		}
+
+		reduce();
+
+		return static_cast < digit_t > (remainder);
+	}
+
+// ---------- remainder, sign, absolute value ---------------------------------------
+
+	int sign() const
+	{
+		if (*this == Integer(0)) return 0;
+		return m_is_negative ? -1 : 1;
+	}
+
+	Integer abs() const
+	{
+		if (sign() < 0)
+		{
+			Integer result = *this;
+			result.m_is_negative = false;
+			return result;
+		}
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto bit_length() const -> std::size_t
+	{
+		return std::size(m_digits) * s_bits - std::countl_zero(m_digits.back());
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto trailing_zeros() const -> std::size_t
+	{
+		auto index = 0uz;
+
+		while (index + 1 < std::size(m_digits) && !m_digits[index])
+		{
+			++index;
+		}
+
+		return m_digits[index] ? index * s_bits + std::countr_zero(m_digits[index]) : 0;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto popcount() const -> std::size_t
+	{
+		auto count = 0uz;
+
+		for (auto digit : m_digits)
+		{
+			count += std::popcount(digit);
+		}
+
+		return count;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto test_bit(std::size_t index) const -> bool
+	{
+		auto bit = index / s_bits < std::size(m_digits) && (m_digits[index / s_bits] >> (index % s_bits) & 1);
+
+		if (m_is_negative)
+		{
+			auto zeros = trailing_zeros();
+
+			return index < zeros ? false : index == zeros ? true : !bit;
+		}
+
+		return bit;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend Integer pow(const Integer& base, unsigned int exp);
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto powmod(Integer const & base, Integer const & exponent, Integer const & modulus) -> Integer;
+
+//  ------------------------------------------------------------------------------------------
+
+	template < integer_range R > friend auto product(R && range) -> Integer;
+
+	template < integer_range R > friend auto sum    (R && range) -> Integer;
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto gcd(Integer const & x, Integer const & y) -> Integer
+	{
+		return gcd_lehmer(x.abs(), y.abs(), nullptr);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto lcm(Integer const & x, Integer const & y) -> Integer
+	{
+		if (x == 0 || y == 0)
+		{
+			return 0;
+		}
+
+		return (x / gcd(x, y) * y).abs();
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto xgcd(Integer const & x, Integer const & y) -> std::tuple < Integer, Integer, Integer >
+	{
+		Integer u;
+
+		auto g = gcd_lehmer(x.abs(), y.abs(), &u);
+
+		if (x.m_is_negative)
+		{
+			u = -std::move(u);
+		}
+
+		if (y == 0)
+		{
+			return { std::move(g), std::move(u), 0 };
+		}
+
+		auto step = y.abs() / g;
+
+		u %= step;
+
+		if (step < u.abs() * 2)
+		{
+			u.m_is_negative ? u += step : u -= step;
+		}
+
+		auto v = (g - u * x) / y;
+
+		return { std::move(g), std::move(u), std::move(v) };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto modinv(Integer const & x, Integer const & modulus) -> Integer
+	{
+		if (modulus == 0)
+		{
+			throw std::domain_error("zero modulus");
+		}
+
+		auto m = modulus.abs(), a = x % m;
+
+		if (a.m_is_negative)
+		{
+			a += m;
+		}
+
+		Integer u;
+
+		if (gcd_lehmer(std::move(a), m, &u) != 1)
+		{
+			throw std::domain_error("no modular inverse");
+		}
+
+		u %= m;
+
+		if (u.m_is_negative)
+		{
+			u += m;
+		}
+
+		return u;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto serialized_size() const -> std::size_t
+	{
+		return sizeof(header_t) + std::size(m_digits) * sizeof(digit_t);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto serialize(std::span < std::byte > buffer) const -> std::size_t
+	{
+		if (std::size(buffer) < serialized_size())
+		{
+			throw std::length_error("buffer too small");
+		}
+
+		store_header(buffer.data(), *this);
+
+		store_digits(buffer.data() + sizeof(header_t), digits());
+
+		return serialized_size();
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto deserialize(std::span < std::byte const > buffer) -> std::pair < Integer, std::size_t >
+	{
+		auto header = load_header(buffer);
+
+		if ((std::size(buffer) - sizeof(header_t)) / sizeof(digit_t) < header.size)
+		{
+			throw std::invalid_argument("invalid binary integer");
+		}
+
+		Integer x;
+
+		x.m_digits.resize(header.size);
+
+		load_digits(x.digits(), buffer.data() + sizeof(header_t));
+
+		x.m_is_negative = header.flags;
+
+		check_record(x.m_is_negative, x.digits());
+
+		auto size = x.serialized_size();
+
+		return { std::move(x), size };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void write(std::ostream & stream) const
+	{
+		std::array < std::byte, sizeof(header_t) > header = {};
+
+		store_header(header.data(), *this);
+
+		stream.write(reinterpret_cast < char const * > (header.data()), std::ssize(header));
+
+		if constexpr (std::endian::native == std::endian::little)
+		{
+			stream.write(reinterpret_cast < char const * > (m_digits.data()), static_cast < std::streamsize > (digits().size_bytes()));
+		}
+		else
+		{
+			for (auto digit : m_digits)
+			{
+				digit = std::byteswap(digit);
+
+				stream.write(reinterpret_cast < char const * > (&digit), sizeof(digit_t));
+			}
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto read(std::istream & stream) -> Integer
+	{
+		std::array < std::byte, sizeof(header_t) > buffer = {};
+
+		if (!stream.read(reinterpret_cast < char * > (buffer.data()), std::ssize(buffer)))
+		{
+			throw std::invalid_argument("invalid binary integer");
+		}
+
+		auto header = load_header(buffer);
+
+		Integer x;
+
+		x.m_digits.clear();
+
+		while (std::size(x.m_digits) < header.size)
+		{
+			auto size = std::size(x.m_digits), step = std::min(header.size - size, s_read_chunk);
+
+			x.m_digits.resize(size + step);
+
+			auto first = reinterpret_cast < char * > (x.m_digits.data() + size);
+
+			if (!stream.read(first, static_cast < std::streamsize > (step * sizeof(digit_t))))
+			{
+				throw std::invalid_argument("invalid binary integer");
+			}
+		}
+
+		if constexpr (std::endian::native != std::endian::little)
+		{
+			for (auto & digit : x.m_digits)
+			{
+				digit = std::byteswap(digit);
+			}
+		}
+
+		x.m_is_negative = header.flags;
+
+		check_record(x.m_is_negative, x.digits());
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::size_t B > friend class FixedInteger;
+
+	friend class IntegerFile;
+
+	friend class Accumulator;
+
+	friend struct KernelBench;
+
+	friend class IntegerView;
+
+private :
+
+	struct header_t
+	{
+		std::array < char, 4 > magic = {};
+
+		std::uint16_t version = 0, flags = 0;
+
+		std::uint64_t size = 0;
+	};
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::unsigned_integral T > static auto little(T x) -> T
+	{
+		if constexpr (std::endian::native == std::endian::little)
+		{
+			return x;
+		}
+		else
+		{
+			return std::byteswap(x);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void store_header(std::byte * first, Integer const & x)
+	{
+		header_t header = 
+		{ 
+			s_magic, little(s_version), little(static_cast < std::uint16_t > (x.m_is_negative)), 
+			
+			little(static_cast < std::uint64_t > (std::size(x.m_digits))) 
+		};
+
+		std::memcpy(first, &header, sizeof(header_t));
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto load_header(std::span < std::byte const > buffer) -> header_t
+	{
+		header_t header;
+
+		if (std::size(buffer) < sizeof(header_t))
+		{
+			throw std::invalid_argument("invalid binary integer");
+		}
+
+		std::memcpy(&header, buffer.data(), sizeof(header_t));
+
+		header.version = little(header.version);
+
+		header.flags = little(header.flags);
+
+		header.size = little(header.size);
+
+		if (header.magic != s_magic || header.version != s_version || header.flags > 1 || header.size == 0)
+		{
+			throw std::invalid_argument("invalid binary integer");
+		}
+
+		return header;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void store_digits(std::byte * first, std::span < digit_t const > x)
+	{
+		if constexpr (std::endian::native == std::endian::little)
+		{
+			std::memcpy(first, x.data(), x.size_bytes());
+		}
+		else
+		{
+			for (auto i = 0uz; i < std::size(x); ++i)
+			{
+				auto digit = std::byteswap(x[i]);
+
+				std::memcpy(first + i * sizeof(digit_t), &digit, sizeof(digit_t));
+			}
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void load_digits(std::span < digit_t > x, std::byte const * first)
+	{
+		std::memcpy(x.data(), first, x.size_bytes());
+
+		for (auto & digit : x)
+		{
+			digit = little(digit);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void check_record(bool is_negative, std::span < digit_t const > x)
+	{
+		if ((std::size(x) > 1 && !x.back()) || (std::size(x) == 1 && !x.front() && is_negative))
+		{
+			throw std::invalid_argument("invalid binary integer");
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	class NoReduction;
+
+	class MontgomeryReduction;
+
+	class BarrettReduction;
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename R > static auto exponentiate(R const & reduction, Integer const & base, Integer const & exponent)
+	{
+		if (exponent == 0)
+		{
+			return reduction.from(reduction.one());
+		}
+
+		auto bits = static_cast < std::ptrdiff_t > (exponent.bit_length());
+
+		auto width = bits > 671 ? 6l : bits > 239 ? 5l : bits > 79 ? 4l : bits > 23 ? 3l : bits > 7 ? 2l : 1l;
+
+		std::vector < Integer > table(1uz << (width - 1));
+
+		table[0] = reduction.to(base);
+
+		if (std::size(table) > 1)
+		{
+			auto square = reduction.multiply(table[0], table[0]);
+
+			for (auto i = 1uz; i < std::size(table); ++i)
+			{
+				table[i] = reduction.multiply(table[i - 1], square);
+			}
+		}
+
+		Integer x;
+
+		auto is_one = true;
+
+		for (auto i = bits - 1; i >= 0;)
+		{
+			if (!exponent.test_bit(static_cast < std::size_t > (i)))
+			{
+				x = reduction.multiply(x, x);
+
+				--i;
+
+				continue;
+			}
+
+			auto j = std::max(i - width + 1, 0l);
+
+			while (!exponent.test_bit(static_cast < std::size_t > (j)))
+			{
+				++j;
+			}
+
+			auto index = 0uz;
+
+			for (auto k = i; k >= j; --k)
+			{
+				index = index << 1 | exponent.test_bit(static_cast < std::size_t > (k));
+
+				if (!is_one)
+				{
+					x = reduction.multiply(x, x);
+				}
+			}
+
+			x = is_one ? table[index / 2] : reduction.multiply(x, table[index / 2]);
+
+			is_one = false;
+
+			i = j - 1;
+		}
+
+		return reduction.from(x);
+	}
+
+	void parse(std::string const & string)
+	{
+		auto first = string.data(), last = first + std::size(string);
+
+		if (first != last && *first == '+')
+		{
+			++first;
+		}
+
+		if (auto [end, error] = from_chars(first, last, *this); error != std::errc() || end != last)
+		{
+			throw std::invalid_argument("invalid integer");
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto parse_chunk(char const * first, std::size_t size) -> digit_t
+	{
+		digit_t x = 0;
+
+		for (auto i = 0uz; i < size % 8; ++i)
+		{
+			x = x * 10 + static_cast < digit_t > (*first++ - '0');
+		}
+
+		for (auto i = size % 8; i < size; i += 8, first += 8)
+		{
+			x = x * 100'000'000 + parse_eight(first);
+		}
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto parse_eight(char const * first) -> digit_t
+	{
+		if constexpr (std::endian::native == std::endian::little)
+		{
+			digit_t x = 0;
+
+			std::memcpy(&x, first, 8);
+
+			x -= 0x30'30'30'30'30'30'30'30;
+
+			x = (x * 10) + (x >> 8);
+
+			x = ((x & 0x00'00'00'ff'00'00'00'ff) * (100 + (1'000'000ull << 32)) + 
+			
+				((x >> 16) & 0x00'00'00'ff'00'00'00'ff) * (1 + (10'000ull << 32))) >> 32;
+
+			return x;
+		}
+		else
+		{
+			return parse_chunk(first, 7) * 10 + static_cast < digit_t > (first[7] - '0');
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto power(std::vector < Integer > & powers, std::size_t level) -> Integer const &
+	{
+		if (std::empty(powers))
+		{
+			powers.push_back(s_radix);
+		}
+
+		while (std::size(powers) <= level)
+		{
+			powers.push_back(powers.back() * powers.back());
+		}
+
+		return powers[level];
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto convert(digit_t const * chunks, std::size_t size, std::vector < Integer > & powers) -> Integer
+	{
+		Integer x;
+
+		if (size <= s_convert_threshold)
+		{
+			for (auto i = static_cast < std::ptrdiff_t > (size) - 1; i >= 0; --i)
+			{
+				x.mul_add_small(s_radix, chunks[i]);
+			}
+
+			return x;
+		}
+
+		auto level = 0uz;
+
+		while ((2uz << level) < size) 
+		{
+			++level;
+		}
+
+		auto step = 1uz << level;
+
+		x = convert(chunks + step, size - step, powers) * power(powers, level);
+
+		return x += convert(chunks, step, powers);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void split(digit_t * chunks, Integer const & x, std::size_t size, std::vector < Integer > & powers)
+	{
+		if (size <= s_convert_threshold)
+		{
+			auto y = x;
+
+			for (auto i = 0uz; i < size; ++i)
+			{
+				chunks[i] = y.divmod_small(s_radix);
+			}
+
+			return;
+		}
+
+		auto level = static_cast < std::size_t > (std::bit_width(size - 1) - 1);
+
+		auto step = 1uz << level;
+
+		auto [quotient, remainder] = divmod(x, power(powers, level));
+
+		split(chunks, remainder, step, powers);
+
+		split(chunks + step, quotient, size - step, powers);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void print_chunk(char * first, digit_t chunk)
+	{
+		static constexpr auto pairs = []()
+		{
+			std::array < char, 200 > pairs = {};
+
+			for (auto i = 0; i < 100; ++i)
+			{
+				pairs[2 * i + 0] = static_cast < char > ('0' + i / 10);
+
+				pairs[2 * i + 1] = static_cast < char > ('0' + i % 10);
+			}
+
+			return pairs;
+		}();
+
+		for (auto i = s_step; i > 1; i -= 2, chunk /= 100)
+		{
+			std::memcpy(first + i - 2, &pairs[2 * (chunk % 100)], 2);
+		}
+
+		if (s_step % 2)
+		{
+			first[0] = static_cast < char > ('0' + chunk);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto print(char * first, char * last, IntegerView const & x) -> std::to_chars_result
+	{
+		std::vector < digit_t > chunks(x.bit_length() / (s_bits - 1) + 1);
+
+		std::vector < Integer > powers;
+
+		split(chunks.data(), Integer(x.abs()), std::size(chunks), powers);
+
+		auto size = std::size(chunks);
+
+		while (size > 1 && !chunks[size - 1])
+		{
+			--size;
+		}
+
+		char top[s_step];
+
+		auto end = std::to_chars(top, top + s_step, chunks[size - 1]).ptr;
+
+		auto length = static_cast < std::size_t > (x.is_negative() + (end - top)) + (size - 1) * s_step;
+
+		if (static_cast < std::size_t > (last - first) < length)
+		{
+			return { last, std::errc::value_too_large };
+		}
+
+		if (x.is_negative())
+		{
+			*first++ = '-';
+		}
+
+		first = std::copy(top, end, first);
+
+		for (auto i = size - 1; i > 0; --i, first += s_step)
+		{
+			print_chunk(first, chunks[i - 1]);
+		}
+
+		return { first, std::errc() };
+	}
+//  ------------------------------------------------------------------------------------------
+
+	auto digits()       -> std::span < digit_t       > { return m_digits; }
+
+	auto digits() const -> std::span < digit_t const > { return m_digits; }
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto add_to(std::span < digit_t > z, std::span < digit_t const > x) -> digit_t
+	{
+		auto size = std::min(std::size(z), std::size(x));
+
+		auto carry = add_n(z.data(), x.data(), size);
+
+		for (auto i = size; i < std::size(z) && carry; ++i)
+		{
+			carry = ++z[i] == 0;
+		}
+
+		return carry;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto sub_from(std::span < digit_t > z, std::span < digit_t const > x) -> digit_t
+	{
+		auto size = std::min(std::size(z), std::size(x));
+
+		auto borrow = sub_n(z.data(), x.data(), size);
+
+		for (auto i = size; i < std::size(z) && borrow; ++i)
+		{
+			borrow = z[i]-- == 0;
+		}
+
+		return borrow;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto add_n(digit_t * z, digit_t const * x, std::size_t size) -> digit_t
+	{
+		switch (s_kernel)
+		{
+#if defined(__x86_64__)
+
+			case Kernel::avx512 : return add_n_avx512(z, x, size);
+
+			case Kernel::avx2   : return add_n_avx2  (z, x, size);
+
+#endif
+
+			default : return add_n_scalar(z, x, size, 0);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto sub_n(digit_t * z, digit_t const * x, std::size_t size) -> digit_t
+	{
+		switch (s_kernel)
+		{
+#if defined(__x86_64__)
+
+			case Kernel::avx512 : return sub_n_avx512(z, x, size);
+
+			case Kernel::avx2   : return sub_n_avx2  (z, x, size);
+
+#endif
+
+			default : return sub_n_scalar(z, x, size, 0);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto compare(digit_t const * x, digit_t const * y, std::size_t size) -> int
+	{
+		switch (s_kernel)
+		{
+#if defined(__x86_64__)
+
+			case Kernel::avx512 : return compare_avx512(x, y, size);
+
+			case Kernel::avx2   : return compare_avx2  (x, y, size);
+
+#endif
+
+			default : return compare_scalar(x, y, size);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename C > static void add_carry_save(digit_t * z, C * carries, digit_t const * x, std::size_t size)
+	{
+		switch (s_kernel)
+		{
+#if defined(__x86_64__)
+
+			case Kernel::avx512 : return add_carry_save_avx512(z, carries, x, size);
+
+			case Kernel::avx2   : return add_carry_save_avx2  (z, carries, x, size);
+
+#endif
+
+			default : return add_carry_save_scalar(z, carries, x, size);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto add_n_scalar(digit_t * z, digit_t const * x, std::size_t size, digit_t carry) -> digit_t
+	{
+		for (auto i = 0uz; i < size; ++i)
+		{
+			auto digit = static_cast < wide_t > (z[i]) + x[i] + carry;
+
+			z[i] = static_cast < digit_t > (digit);
+
+			carry = static_cast < digit_t > (digit >> s_bits);
+		}
+
+		return carry;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto sub_n_scalar(digit_t * z, digit_t const * x, std::size_t size, digit_t borrow) -> digit_t
+	{
+		for (auto i = 0uz; i < size; ++i)
+		{
+			auto y = z[i] - x[i] - borrow;
+
+			borrow = (z[i] < x[i]) || (z[i] - x[i] < borrow);
+
+			z[i] = y;
+		}
+
+		return borrow;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto compare_scalar(digit_t const * x, digit_t const * y, std::size_t size) -> int
+	{
+		for (auto i = size; i-- > 0;)
+		{
+			if (x[i] != y[i])
+			{
+				return x[i] < y[i] ? -1 : 1;
+			}
+		}
+
+		return 0;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename C > static void add_carry_save_scalar(digit_t * z, C * carries, digit_t const * x, std::size_t size)
+	{
+		for (auto i = 0uz; i < size; ++i)
+		{
+			auto digit = z[i] + x[i];
+
+			carries[i] += digit < x[i];
+
+			z[i] = digit;
+		}
+	}
+
+#if defined(__x86_64__)
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx2"))) static auto add_n_avx2(digit_t * z, digit_t const * x, std::size_t size) -> digit_t
+	{
+		auto const sign = _mm256_set1_epi64x(std::numeric_limits < long long > ::min());
+
+		auto const ones = _mm256_set1_epi64x(-1), one = _mm256_set1_epi64x(1);
+
+		auto const lanes = _mm256_set_epi64x(3, 2, 1, 0);
+
+		auto carry = 0u;
+
+		auto i = 0uz;
+
+		for (; i + 4 <= size; i += 4)
+		{
+			auto a = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (z + i));
+
+			auto b = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (x + i));
+
+			auto c = _mm256_add_epi64(a, b);
+
+			auto g = static_cast < unsigned > (_mm256_movemask_pd(_mm256_castsi256_pd(
+
+				_mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), _mm256_xor_si256(c, sign)))));
+
+			auto p = static_cast < unsigned > (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(c, ones))));
+
+			auto carries = ((g << 1 | carry) + p) ^ p;
+
+			auto mask = _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(carries), lanes), one);
+
+			_mm256_storeu_si256(reinterpret_cast < __m256i * > (z + i), _mm256_add_epi64(c, mask));
+
+			carry = carries >> 4 & 1;
+		}
+
+		return add_n_scalar(z + i, x + i, size - i, carry);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx2"))) static auto sub_n_avx2(digit_t * z, digit_t const * x, std::size_t size) -> digit_t
+	{
+		auto const sign = _mm256_set1_epi64x(std::numeric_limits < long long > ::min());
+
+		auto const zero = _mm256_setzero_si256(), one = _mm256_set1_epi64x(1);
+
+		auto const lanes = _mm256_set_epi64x(3, 2, 1, 0);
+
+		auto borrow = 0u;
+
+		auto i = 0uz;
+
+		for (; i + 4 <= size; i += 4)
+		{
+			auto a = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (z + i));
+
+			auto b = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (x + i));
+
+			auto c = _mm256_sub_epi64(a, b);
+
+			auto g = static_cast < unsigned > (_mm256_movemask_pd(_mm256_castsi256_pd(
+
+				_mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign)))));
+
+			auto p = static_cast < unsigned > (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(c, zero))));
+
+			auto borrows = ((g << 1 | borrow) + p) ^ p;
+
+			auto mask = _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(borrows), lanes), one);
+
+			_mm256_storeu_si256(reinterpret_cast < __m256i * > (z + i), _mm256_sub_epi64(c, mask));
+
+			borrow = borrows >> 4 & 1;
+		}
+
+		return sub_n_scalar(z + i, x + i, size - i, borrow);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx2"))) static auto compare_avx2(digit_t const * x, digit_t const * y, std::size_t size) -> int
+	{
+		auto i = size;
+
+		for (; i >= 4; i -= 4)
+		{
+			auto a = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (x + i - 4));
+
+			auto b = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (y + i - 4));
+
+			auto mask = ~static_cast < unsigned > (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)))) & 0xf;
+
+			if (mask)
+			{
+				auto j = i - 4 + static_cast < std::size_t > (std::bit_width(mask) - 1);
+
+				return x[j] < y[j] ? -1 : 1;
+			}
+		}
+
+		return compare_scalar(x, y, i);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx2"))) static void add_carry_save_avx2(digit_t * z, digit_t * carries, digit_t const * x, std::size_t size)
+	{
+		auto const sign = _mm256_set1_epi64x(std::numeric_limits < long long > ::min());
+
+		auto i = 0uz;
+
+		for (; i + 4 <= size; i += 4)
+		{
+			auto a = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (z + i));
+
+			auto b = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (x + i));
+
+			auto c = _mm256_add_epi64(a, b);
+
+			auto g = _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(c, sign));
+
+			auto d = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (carries + i));
+
+			_mm256_storeu_si256(reinterpret_cast < __m256i * > (z + i), c);
+
+			_mm256_storeu_si256(reinterpret_cast < __m256i * > (carries + i), _mm256_sub_epi64(d, g));
+		}
+
+		add_carry_save_scalar(z + i, carries + i, x + i, size - i);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx2"))) static void add_carry_save_avx2(digit_t * z, std::uint16_t * carries, digit_t const * x, std::size_t size)
+	{
+		auto const sign = _mm256_set1_epi64x(std::numeric_limits < long long > ::min());
+
+		auto i = 0uz;
+
+		for (; i + 4 <= size; i += 4)
+		{
+			auto a = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (z + i));
+
+			auto b = _mm256_loadu_si256(reinterpret_cast < __m256i const * > (x + i));
+
+			auto c = _mm256_add_epi64(a, b);
+
+			auto g = static_cast < digit_t > (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(c, sign)))));
+
+			digit_t d; std::memcpy(&d, carries + i, sizeof(d));
+
+			d += (g & 1) | (g & 2) << 15 | (g & 4) << 30 | (g & 8) << 45;
+
+			std::memcpy(carries + i, &d, sizeof(d));
+
+			_mm256_storeu_si256(reinterpret_cast < __m256i * > (z + i), c);
+		}
+
+		add_carry_save_scalar(z + i, carries + i, x + i, size - i);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx512f"))) static auto add_n_avx512(digit_t * z, digit_t const * x, std::size_t size) -> digit_t
+	{
+		auto const ones = _mm512_set1_epi64(-1), one = _mm512_set1_epi64(1);
+
+		auto carry = 0u;
+
+		auto i = 0uz;
+
+		for (; i + 8 <= size; i += 8)
+		{
+			auto a = _mm512_loadu_si512(z + i), b = _mm512_loadu_si512(x + i);
+
+			auto c = _mm512_add_epi64(a, b);
+
+			auto g = static_cast < unsigned > (_mm512_cmplt_epu64_mask(c, a));
+
+			auto p = static_cast < unsigned > (_mm512_cmpeq_epi64_mask(c, ones));
+
+			auto carries = ((g << 1 | carry) + p) ^ p;
+
+			_mm512_storeu_si512(z + i, _mm512_mask_add_epi64(c, static_cast < __mmask8 > (carries), c, one));
+
+			carry = carries >> 8 & 1;
+		}
+
+		return add_n_scalar(z + i, x + i, size - i, carry);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx512f"))) static auto sub_n_avx512(digit_t * z, digit_t const * x, std::size_t size) -> digit_t
+	{
+		auto const zero = _mm512_setzero_si512(), one = _mm512_set1_epi64(1);
+
+		auto borrow = 0u;
+
+		auto i = 0uz;
+
+		for (; i + 8 <= size; i += 8)
+		{
+			auto a = _mm512_loadu_si512(z + i), b = _mm512_loadu_si512(x + i);
+
+			auto c = _mm512_sub_epi64(a, b);
+
+			auto g = static_cast < unsigned > (_mm512_cmplt_epu64_mask(a, b));
+
+			auto p = static_cast < unsigned > (_mm512_cmpeq_epi64_mask(c, zero));
+
+			auto borrows = ((g << 1 | borrow) + p) ^ p;
+
+			_mm512_storeu_si512(z + i, _mm512_mask_sub_epi64(c, static_cast < __mmask8 > (borrows), c, one));
+
+			borrow = borrows >> 8 & 1;
+		}
+
+		return sub_n_scalar(z + i, x + i, size - i, borrow);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx512f"))) static auto compare_avx512(digit_t const * x, digit_t const * y, std::size_t size) -> int
+	{
+		auto i = size;
+
+		for (; i >= 8; i -= 8)
+		{
+			auto a = _mm512_loadu_si512(x + i - 8), b = _mm512_loadu_si512(y + i - 8);
+
+			if (auto mask = static_cast < unsigned > (_mm512_cmpneq_epu64_mask(a, b)); mask)
+			{
+				auto j = i - 8 + static_cast < std::size_t > (std::bit_width(mask) - 1);
+
+				return x[j] < y[j] ? -1 : 1;
+			}
+		}
+
+		return compare_scalar(x, y, i);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx512f"))) static void add_carry_save_avx512(digit_t * z, digit_t * carries, digit_t const * x, std::size_t size)
+	{
+		auto const one = _mm512_set1_epi64(1);
+
+		auto i = 0uz;
+
+		for (; i + 8 <= size; i += 8)
+		{
+			auto a = _mm512_loadu_si512(z + i), b = _mm512_loadu_si512(x + i);
+
+			auto c = _mm512_add_epi64(a, b);
+
+			auto d = _mm512_loadu_si512(carries + i);
+
+			_mm512_storeu_si512(z + i, c);
+
+			_mm512_storeu_si512(carries + i, _mm512_mask_add_epi64(d, _mm512_cmplt_epu64_mask(c, b), d, one));
+		}
+
+		add_carry_save_scalar(z + i, carries + i, x + i, size - i);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	__attribute__((target("avx512f"))) static void add_carry_save_avx512(digit_t * z, std::uint16_t * carries, digit_t const * x, std::size_t size)
+	{
+		auto const one = _mm512_set1_epi64(1);
+
+		auto i = 0uz;
+
+		for (; i + 8 <= size; i += 8)
+		{
+			auto a = _mm512_loadu_si512(z + i), b = _mm512_loadu_si512(x + i);
+
+			auto c = _mm512_add_epi64(a, b);
+
+			auto d = _mm_loadu_si128(reinterpret_cast < __m128i const * > (carries + i));
+
+			_mm512_storeu_si512(z + i, c);
+
+			_mm_storeu_si128(reinterpret_cast < __m128i * > (carries + i), _mm_add_epi16(d, _mm512_maskz_cvtepi64_epi16(_mm512_cmplt_epu64_mask(c, b), one)));
+		}
+
+		add_carry_save_scalar(z + i, carries + i, x + i, size - i);
+	}
+
+#endif
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto sub_reverse(std::span < digit_t > z, std::span < digit_t const > x) -> digit_t
+	{
+		digit_t borrow = 0;
+
+		for (auto i = 0uz; i < std::size(z); ++i)
+		{
+			auto y = x[i] - z[i] - borrow;
+
+			borrow = (x[i] < z[i]) || (x[i] - z[i] < borrow);
+
+			z[i] = y;
+		}
+
+		return borrow;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto karatsuba_threshold() -> std::size_t
+	{ 
+		return std::max(s_karatsuba_threshold, 4uz);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto toom3_threshold() -> std::size_t
+	{ 
+		return std::max(s_toom3_threshold, 8uz);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto scratch_size(std::size_t size) -> std::size_t
+	{
+		return 4 * size + 16 * (std::bit_width(size) + 1);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void mul
+	(
+		std::span < digit_t       > z, 
+		std::span < digit_t const > x, 
+		std::span < digit_t const > y, 
+		std::span < digit_t       > scratch
+	)
+	{
+		if (std::size(x) < std::size(y))
+		{
+			std::swap(x, y);
+		}
+
+		if (std::size(y) < karatsuba_threshold())
+		{
+			mul_schoolbook(z, x, y);
+		}
+		else if (std::size(y) >= s_ntt_threshold)
+		{
+			mul_ntt(z, x, y);
+		}
+		else if (std::size(y) <= (std::size(x) + 1) / 2)
+		{
+			mul_unbalanced(z, x, y, scratch);
+		}
+		else if (std::size(y) < toom3_threshold())
+		{
+			mul_karatsuba(z, x, y, scratch);
+		}
+		else
+		{
+			mul_toom3(z, x, y);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void mul_schoolbook(std::span < digit_t > z, std::span < digit_t const > x, std::span < digit_t const > y)
+	{
+		std::ranges::fill(z, 0);
+
+		for (auto i = 0uz; i < std::size(y); ++i)
+		{
+			digit_t remainder = 0;
+
+			for (auto j = 0uz; j < std::size(x); ++j)
+			{
+				auto digit = static_cast < wide_t > (x[j]) * y[i] + z[i + j] + remainder;
+
+				z[i + j] = static_cast < digit_t > (digit);
+
+				remainder = static_cast < digit_t > (digit >> s_bits);
+			}
+
+			z[i + std::size(x)] = remainder;
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void mul_unbalanced
+	(
+		std::span < digit_t       > z, 
+		std::span < digit_t const > x, 
+		std::span < digit_t const > y, 
+		std::span < digit_t       > scratch
+	)
+	{
+		auto step = std::size(y);
+
+		auto product = scratch.first(2 * step);
+
+		std::ranges::fill(z, 0);
+
+		for (auto i = 0uz; i < std::size(x); i += step)
+		{
+			auto part = x.subspan(i, std::min(step, std::size(x) - i));
+
+			mul(product.first(std::size(part) + step), part, y, scratch.subspan(2 * step));
+
+			add_to(z.subspan(i), product.first(std::size(part) + step));
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void mul_karatsuba
+	(
+		std::span < digit_t       > z, 
+		std::span < digit_t const > x, 
+		std::span < digit_t const > y, 
+		std::span < digit_t       > scratch
+	)
+	{
+		auto step = (std::size(x) + 1) / 2;
+
+		auto x1 = x.first(step), x2 = x.subspan(step);
+
+		auto y1 = y.first(step), y2 = y.subspan(step);
+
+		auto b = z.first(2 * step), a = z.subspan(2 * step);
+
+		auto x3 = scratch.first(step + 1);
+
+		auto y3 = scratch.subspan(step + 1, step + 1);
+
+		auto c = scratch.subspan(2 * step + 2, 2 * step + 2);
+
+		std::ranges::copy(x1, x3.begin()); x3.back() = 0; add_to(x3, x2);
+
+		std::ranges::copy(y1, y3.begin()); y3.back() = 0; add_to(y3, y2);
+
+		auto & workspace = Workspace::current();
+
+		Workspace::Frame frame(workspace);
+
+		auto tail = scratch.subspan(4 * step + 4), scratch_a = tail, scratch_b = tail;
+
+		auto is_parallel = Integer::is_parallel(std::size(x));
+
+		if (is_parallel)
+		{
+			scratch_a = workspace.allocate(scratch_size(step));
+
+			scratch_b = workspace.allocate(scratch_size(step));
+		}
+
+		parallel_invoke
+		(
+			is_parallel,
+
+			[&](){ mul(b, x1, y1, scratch_b); },
+
+			[&](){ mul(a, x2, y2, scratch_a); },
+
+			[&](){ mul(c, x3, y3, tail); }
+		);
+
+		sub_from(c, b);
+
+		sub_from(c, a);
+
+		add_to(z.subspan(step), c.first(std::min(std::size(c), std::size(z) - step)));
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto threads() -> std::size_t
+	{
+		auto pool = ThreadPool::current();
+
+		return pool ? pool->size() : std::max(s_threads, 1uz);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto is_parallel(std::size_t size) -> bool
+	{
+		return threads() > 1 && size >= s_parallel_threshold;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto pool() -> ThreadPool &
+	{
+		if (auto pool = ThreadPool::current(); pool)
+		{
+			return *pool;
+		}
+
+		static std::atomic < ThreadPool * > current = nullptr;
+
+		auto size = threads();
+
+		if (auto pool = current.load(std::memory_order_acquire); pool && pool->size() == size)
+		{
+			return *pool;
+		}
+
+		static std::mutex mutex;
+
+		static std::vector < std::unique_ptr < ThreadPool > > pools;
+
+		std::scoped_lock lock(mutex);
+
+		auto pool = std::ranges::find(pools, size, [](auto const & pool){ return pool->size(); });
+
+		if (pool == std::end(pools))
+		{
+			pool = pools.insert(pool, std::make_unique < ThreadPool > (size));
+		}
+
+		current.store(pool->get(), std::memory_order_release);
+
+		return **pool;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename F > static void parallel_for(bool is_parallel, std::size_t count, F const & f)
+	{
+		if (is_parallel)
+		{
+			pool().run(count, f);
+		}
+		else
+		{
+			for (auto i = 0uz; i < count; ++i)
+			{
+				f(i);
+			}
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename ... F > static void parallel_invoke(bool is_parallel, F const & ... functions)
+	{
+		if (!is_parallel)
+		{
+			(functions(), ...);
+
+			return;
+		}
+
+		task_t const tasks[] = { functions... };
+
+		parallel_for(true, sizeof...(F), [&tasks](std::size_t i){ tasks[i](); });
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename R > static auto limbs(R const & range, std::size_t begin, std::size_t end) -> std::size_t
+	{
+		if constexpr (std::same_as < std::ranges::range_value_t < R > , Integer > )
+		{
+			auto size = 0uz;
+
+			for (auto i = begin; i < end; ++i)
+			{
+				size += std::size(std::ranges::begin(range)[i].m_digits);
+			}
+
+			return size;
+		}
+		else
+		{
+			return end - begin;
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename R > static auto product_tree(R const & range, std::size_t begin, std::size_t end, std::size_t depth) -> Integer
+	{
+		if (end - begin <= s_product_leaf)
+		{
+			Integer x = 1;
+
+			for (auto i = begin; i < end; ++i)
+			{
+				x *= std::ranges::begin(range)[i];
+			}
+
+			return x;
+		}
+
+		auto middle = begin + (end - begin) / 2;
+
+		Integer x, y;
+
+		parallel_invoke
+		(
+			depth < static_cast < std::size_t > (std::bit_width(threads())) && is_parallel(limbs(range, begin, middle)),
+
+			[&](){ x = product_tree(range, begin, middle, depth + 1); },
+
+			[&](){ y = product_tree(range, middle,   end, depth + 1); }
+		);
+
+		return x * y;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto make_integer(std::span < digit_t const > digits)
+	{
+		Integer x;
+
+		if (!std::empty(digits))
+		{
+			x.m_digits.resize(std::size(digits));
+
+			std::ranges::copy(digits, x.m_digits.begin());
+
+			x.reduce();
+		}
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto mul_add_n(std::span < digit_t > z, std::span < digit_t const > x, digit_t factor) -> digit_t
+	{
+		digit_t carry = 0;
+
+		for (auto i = 0uz; i < std::size(x); ++i)
+		{
+			auto digit = static_cast < wide_t > (x[i]) * factor + z[i] + carry;
+
+			z[i] = static_cast < digit_t > (digit);
+
+			carry = static_cast < digit_t > (digit >> s_bits);
+		}
+
+		return carry;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto shift_left(std::size_t shift) const -> Integer
+	{
+		Integer x;
+
+		x.m_digits.resize(std::size(m_digits) + shift / s_bits + 1, 0);
+
+		x.m_digits.back() = shift_left(x.digits().subspan(shift / s_bits), digits(), shift % s_bits);
+
+		x.reduce();
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto shift_right(std::size_t shift) const -> Integer
+	{
+		Integer x;
+
+		if (shift / s_bits < std::size(m_digits))
+		{
+			x.m_digits.resize(std::size(m_digits) - shift / s_bits, 0);
+
+			shift_right(x.digits(), digits().subspan(shift / s_bits), shift % s_bits);
+
+			x.reduce();
+		}
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto slice(std::size_t begin, std::size_t size) const
+	{
+		begin = std::min(begin, std::size(m_digits));
+
+		return make_integer(digits().subspan(begin, std::min(size, std::size(m_digits) - begin)));
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto join(IntegerView const & high, IntegerView const & low, std::size_t size)
+	{
+		Integer x;
+
+		x.m_digits.resize(std::max(std::size(high.digits()) + size, 1uz), 0);
+
+		std::ranges::copy(low.digits(), x.m_digits.begin());
+
+		std::ranges::copy(high.digits(), x.m_digits.begin() + size);
+
+		x.reduce();
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename F > static auto bitwise(Integer const & x, Integer const & y, F f) -> Integer
+	{
+		auto size = std::max(std::size(x.m_digits), std::size(y.m_digits)) + 1;
+
+		digit_t mask_x = x.m_is_negative ? ~0ull : 0, carry_x = x.m_is_negative;
+
+		digit_t mask_y = y.m_is_negative ? ~0ull : 0, carry_y = y.m_is_negative;
+
+		digit_t mask_z = f(mask_x, mask_y), carry_z = mask_z & 1;
+
+		Integer z;
+
+		z.m_digits.resize(size, 0);
+
+		for (auto i = 0uz; i < size; ++i)
+		{
+			auto a = (i < std::size(x.m_digits) ? x.m_digits[i] : 0) ^ mask_x;
+
+			auto b = (i < std::size(y.m_digits) ? y.m_digits[i] : 0) ^ mask_y;
+
+			a += carry_x;
+
+			carry_x = carry_x && !a;
+
+			b += carry_y;
+
+			carry_y = carry_y && !b;
+
+			auto c = f(a, b) ^ mask_z;
+
+			c += carry_z;
+
+			carry_z = carry_z && !c;
+
+			z.m_digits[i] = c;
+		}
+
+		z.m_is_negative = mask_z;
+
+		z.reduce();
+
+		return z;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	using matrix_t = std::array < Integer, 4 > ;
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto half_gcd_threshold() -> std::size_t
+	{
+		return std::max(s_half_gcd_threshold, 32uz);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto gcd_binary(digit_t x, digit_t y) -> digit_t
+	{
+		if (!x || !y)
+		{
+			return x | y;
+		}
+
+		auto shift = std::countr_zero(x | y);
+
+		x >>= std::countr_zero(x);
+
+		while (y)
+		{
+			y >>= std::countr_zero(y);
+
+			if (x > y)
+			{
+				std::swap(x, y);
+			}
+
+			y -= x;
+		}
+
+		return x << shift;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto gcd_lehmer(Integer a, Integer b, Integer * cofactor) -> Integer
+	{
+		matrix_t m = { 1, 0, 0, 0 };
+
+		auto tracked = cofactor ? &m : nullptr;
+
+		if (a.less(b))
+		{
+			a.swap(b);
+
+			m[0].swap(m[2]);
+		}
+
+		while (b != 0)
+		{
+			if (!cofactor && std::size(a.m_digits) == 1)
+			{
+				a.m_digits.front() = gcd_binary(a.m_digits.front(), b.m_digits.front());
+
+				break;
+			}
+
+			if (auto size = std::size(a.m_digits); size >= half_gcd_threshold() && std::size(b.m_digits) > size / 2 + 1)
+			{
+				auto r = half_gcd(a, b);
+
+				if (cofactor)
+				{
+					apply(r, m[0], m[2]);
+				}
+			}
+			else
+			{
+				gcd_step(a, b, tracked);
+			}
+		}
+
+		if (cofactor)
+		{
+			*cofactor = std::move(m[0]);
+		}
+
+		return a;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto half_gcd(Integer & a, Integer & b) -> matrix_t
+	{
+		matrix_t m = { 1, 0, 0, 1 };
+
+		auto size = std::size(a.m_digits), half = size / 2 + 1;
+
+		if (size >= half_gcd_threshold() / 8)
+		{
+			auto x = a.slice(size / 2, size), y = b.slice(size / 2, size);
+
+			transform(half_gcd(x, y), a, b, m);
+
+			if (std::size(b.m_digits) > half)
+			{
+				auto shift = std::size(a.m_digits) < 2 * half ? 2 * half - std::size(a.m_digits) : 0;
+
+				x = a.slice(shift, size);
+				
+				y = b.slice(shift, size);
+
+				transform(half_gcd(x, y), a, b, m);
+			}
+		}
+
+		while (std::size(b.m_digits) > half)
+		{
+			gcd_step(a, b, &m);
+		}
+
+		return m;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void gcd_step(Integer & a, Integer & b, matrix_t * m)
+	{
+		if (auto l = lehmer_matrix(a, b); l[1])
+		{
+			lehmer_step(a, b, l);
+
+			if (m)
+			{
+				lehmer_step((*m)[0], (*m)[2], l);
+
+				lehmer_step((*m)[1], (*m)[3], l);
+			}
+		}
+		else
+		{
+			auto [q, r] = divmod(a, b);
+
+			a = std::exchange(b, std::move(r));
+
+			if (m)
+			{
+				for (auto i = 0uz; i < 2; ++i)
+				{
+					auto & x = (*m)[i], & y = (*m)[i + 2];
+
+					x = std::exchange(y, x - q * y);
+				}
+			}
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto lehmer_matrix(Integer const & a, Integer const & b) -> std::array < std::int64_t, 4 >
+	{
+		auto shift = a.bit_length() > 62 ? a.bit_length() - 62 : 0uz;
+
+		auto x = static_cast < std::int64_t > (a.window(shift)), a_0 = 1l, b_0 = 0l;
+
+		auto y = static_cast < std::int64_t > (b.window(shift)), a_1 = 0l, b_1 = 1l;
+
+		while (y + a_1 != 0 && y + b_1 != 0)
+		{
+			auto q = (x + a_0) / (y + a_1);
+
+			if (q != (x + b_0) / (y + b_1))
+			{
+				break;
+			}
+
+			a_0 = std::exchange(a_1, a_0 - q * a_1);
+
+			b_0 = std::exchange(b_1, b_0 - q * b_1);
+
+			x = std::exchange(y, x - q * y);
+		}
+
+		return { a_0, b_0, a_1, b_1 };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void lehmer_step(Integer & x, Integer & y, std::array < std::int64_t, 4 > const & l)
+	{
+		__extension__ using signed_wide_t = __int128;
+
+		auto size = std::max(std::size(x.m_digits), std::size(y.m_digits)) + 1;
+
+		x.m_digits.resize(size, 0);
+
+		y.m_digits.resize(size, 0);
+
+		std::int64_t sign_x = x.m_is_negative ? -1 : 1, sign_y = y.m_is_negative ? -1 : 1;
+
+		std::int64_t k[] = { sign_x * l[0], sign_y * l[1], sign_x * l[2], sign_y * l[3] };
+
+		signed_wide_t u = 0, v = 0;
+
+		for (auto i = 0uz; i < size; ++i)
+		{
+			signed_wide_t a = x.m_digits[i], b = y.m_digits[i];
+
+			u += k[0] * a + k[1] * b;
+
+			v += k[2] * a + k[3] * b;
+
+			x.m_digits[i] = static_cast < digit_t > (u);
+
+			y.m_digits[i] = static_cast < digit_t > (v);
+
+			u >>= s_bits;
+
+			v >>= s_bits;
+		}
+
+		for (auto [z, is_negative] : { std::pair < Integer *, bool > (&x, u < 0), std::pair < Integer *, bool > (&y, v < 0) })
+		{
+			if (z->m_is_negative = is_negative; is_negative)
+			{
+				digit_t carry = 1;
+
+				for (auto & digit : z->m_digits)
+				{
+					digit = ~digit + carry;
+
+					carry = carry && !digit;
+				}
+			}
+
+			z->reduce();
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void apply(matrix_t const & r, Integer & x, Integer & y)
+	{
+		auto z = r[0] * x + r[1] * y;
+
+		y = r[2] * x + r[3] * y;
+
+		x = std::move(z);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void transform(matrix_t const & r, Integer & a, Integer & b, matrix_t & m)
+	{
+		apply(r, a, b);
+
+		apply(r, m[0], m[2]);
+
+		apply(r, m[1], m[3]);
+
+		for (auto i = 0uz; i < 2; ++i)
+		{
+			if (auto & x = i ? b : a; x.m_is_negative)
+			{
+				x.m_is_negative = false;
+
+				m[2 * i] = -std::move(m[2 * i]);
+
+				m[2 * i + 1] = -std::move(m[2 * i + 1]);
+			}
+		}
+
+		if (a.less(b))
+		{
+			a.swap(b);
+
+			m[0].swap(m[2]);
+
+			m[1].swap(m[3]);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto window(std::size_t shift) const -> digit_t
+	{
+		auto index = shift / s_bits, offset = shift % s_bits;
+
+		if (index >= std::size(m_digits))
+		{
+			return 0;
+		}
+
+		auto x = m_digits[index] >> offset;
+
+		if (offset && index + 1 < std::size(m_digits))
+		{
+			x |= m_digits[index + 1] << (s_bits - offset);
+		}
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto sqrt_newton(Integer const & x) -> Integer
+	{
+		if (std::size(x.m_digits) == 1)
+		{
+			auto a = x.m_digits.front();
+
+			auto b = static_cast < digit_t > (std::sqrt(static_cast < double > (a)));
+
+			while (static_cast < wide_t > (b) * b > a) 
+			{
+				--b;
+			}
+
+			while (static_cast < wide_t > (b + 1) * (b + 1) <= a) 
+			{
+				++b;
+			}
+
+			return b;
+		}
+
+		auto shift = x.bit_length() / 4;
+
+		auto y = (sqrt_newton(x.shift_right(2 * shift)) + 1).shift_left(shift);
+
+		while (true)
+		{
+			auto z = (y + x / y).shift_right(1);
+
+			if (!z.less(y))
+			{
+				return y;
+			}
+
+			y.swap(z);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto burnikel_ziegler_threshold() -> std::size_t
+	{ 
+		return std::max(s_burnikel_ziegler_threshold, 2uz);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto divmod_knuth(IntegerView const & x, IntegerView const & y) -> std::pair < Integer, Integer >
+	{
+		Integer q, r;
+
+		if (x.abs() < y.abs())
+		{
+			r = Integer(x);
+		}
+		else if (std::size(y.digits()) == 1)
+		{
+			q = Integer(x);
+
+			r = q.divmod_small(y.digits().front());
+		}
+		else
+		{
+			auto shift = std::countl_zero(y.digits().back());
+
+			auto & workspace = Workspace::current();
+
+			Workspace::Frame frame(workspace);
+
+			auto u = workspace.allocate(std::size(x.digits()) + 1), v = workspace.allocate(std::size(y.digits()));
+
+			u.back() = shift_left(u, x.digits(), shift);
+
+			shift_left(v, y.digits(), shift);
+
+			q.m_digits.resize(std::size(u) - std::size(v), 0);
+
+			div_knuth(q.digits(), u, v);
+
+			r.m_digits.resize(std::size(v), 0);
+
+			shift_right(r.digits(), std::span(u).first(std::size(v)), shift);
+		}
+
+		return { std::move(q), std::move(r) };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto divmod_burnikel_ziegler(Integer const & x, Integer const & y) -> std::pair < Integer, Integer >
+	{
+		auto step = 1uz << std::bit_width(std::size(y.m_digits) / burnikel_ziegler_threshold());
+
+		auto size = (std::size(y.m_digits) + step - 1) / step * step;
+
+		auto shift = size * s_bits - y.bit_length();
+
+		auto a = x.shift_left(shift), b = y.shift_left(shift);
+
+		auto blocks = std::max((a.bit_length() + size * s_bits) / (size * s_bits), 2uz);
+
+		auto view = IntegerView(a);
+
+		auto z = join(view.slice((blocks - 1) * size, size), view.slice((blocks - 2) * size, size), size);
+
+		Integer q, r;
+
+		q.m_digits.resize((blocks - 1) * size, 0);
+
+		for (auto i = blocks - 1; i-- > 0;)
+		{
+			auto [q_i, r_i] = divide_2n_1n(z, b, size);
+
+			std::ranges::copy(q_i.m_digits, q.m_digits.begin() + i * size);
+
+			if (i > 0)
+			{
+				z = join(r_i, view.slice((i - 1) * size, size), size);
+			}
+			else
+			{
+				r = r_i.shift_right(shift);
+			}
+		}
+
+		q.reduce();
+
+		return { std::move(q), std::move(r) };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto divide_2n_1n(IntegerView const & a, IntegerView const & b, std::size_t size) -> std::pair < Integer, Integer >
+	{
+		if (size % 2 || size < burnikel_ziegler_threshold())
+		{
+			return divmod_knuth(a, b);
+		}
+
+		auto half = size / 2;
+
+		auto [q_1, r] = divide_3n_2n(a.slice(half, 3 * half), b, half);
+
+		auto [q_2, s] = divide_3n_2n(join(r, a.slice(0, half), half), b, half);
+
+		return { join(q_1, q_2, half), std::move(s) };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto divide_3n_2n(IntegerView const & a, IntegerView const & b, std::size_t half) -> std::pair < Integer, Integer >
+	{
+		auto b_1 = b.slice(half, half), b_2 = b.slice(0, half);
+
+		Integer q, r;
+
+		if (a.slice(2 * half, half) < b_1)
+		{
+			std::tie(q, r) = divide_2n_1n(a.slice(half, 2 * half), b_1, half);
+		}
+		else
+		{
+			q.m_digits.clear();
+
+			q.m_digits.resize(half, std::numeric_limits < digit_t > ::max());
+
+			r = Integer(a.slice(half, 2 * half));
+			
+			r -= join(b_1, IntegerView(), half);
+			
+			r += b_1;
+		}
+
+		r = join(r, a.slice(0, half), half) - multiply(q, b_2);
+
+		while (r.m_is_negative)
+		{
+			r += b;
+
+			--q;
+		}
+
+		return { std::move(q), std::move(r) };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void mul_toom3(std::span < digit_t > z, std::span < digit_t const > x, std::span < digit_t const > y)
+	{
+		auto step = (std::size(x) + 2) / 3;
+
+		auto part = [step](std::span < digit_t const > x, std::size_t i)
+		{
+			return IntegerView(x).slice(i * step, step);
+		};
+
+		auto x0 = part(x, 0), x1 = part(x, 1), x2 = part(x, 2);
+
+		auto y0 = part(y, 0), y1 = part(y, 1), y2 = part(y, 2);
+
+//  ------------------------------------------------------------------------------------------
+
+		auto p1 = Integer(x0); p1 += x2;
+
+		auto q1 = Integer(y0); q1 += y2;
+
+		auto p2 = p1, q2 = q1;
+
+		p1 += x1; p2 -= x1;
+
+		q1 += y1; q2 -= y1;
+
+		auto p3 = p2, q3 = q2;
+
+		p3 += x2; p3 += p3; p3 -= x0;
+
+		q3 += y2; q3 += q3; q3 -= y0;
+
+//  ------------------------------------------------------------------------------------------
+
+		Integer r0, r1, r2, r3, r4;
+
+		parallel_invoke
+		(
+			is_parallel(std::size(x)),
+
+			[&](){ r0.assign_product(x0, y0); }, [&](){ r1.assign_product(p1, q1); }, [&](){ r2.assign_product(p2, q2); },
+
+			[&](){ r3.assign_product(p3, q3); }, [&](){ r4.assign_product(x2, y2); }
+		);
+
+		r3 -= r1; r3.divmod_small(3);
+
+		r1 -= r2; r1.divmod_small(2);
+
+		r2 -= r0;
+
+		r3 = r2 - r3; r3.divmod_small(2); r3 += r4; r3 += r4;
+
+		r2 += r1; r2 -= r4;
+
+		r1 -= r3;
+
+//  ------------------------------------------------------------------------------------------
+
+		std::ranges::fill(z, 0);
+
+		for (auto i = 0uz; auto const & r : { r0, r1, r2, r3, r4 })
+		{
+			if (auto begin = step * i++; begin < std::size(z))
+			{
+				add_to(z.subspan(begin), r.digits());
+			}
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	class Montgomery
+	{
+	public :
+
+		constexpr Montgomery(digit_t modulus) : m_modulus(modulus), m_inverse(modulus)
+		{
+			for (auto i = 0; i < 6; ++i)
+			{
+				m_inverse *= 2 - m_modulus * m_inverse;
+			}
+
+			m_square = static_cast < digit_t > ((0 - m_modulus) % m_modulus);
+
+			m_square = static_cast < digit_t > (static_cast < wide_t > (m_square) * m_square % m_modulus);
+		}
+
+//  ------------------------------------------------------------------------------------------
+
+		constexpr auto modulus() const { return m_modulus; }
+
+//  ------------------------------------------------------------------------------------------
+
+		constexpr auto multiply(digit_t x, digit_t y) const
+		{
+			auto z = static_cast < wide_t > (x) * y;
+
+			auto m = static_cast < digit_t > (z) * m_inverse;
+
+			auto a = static_cast < digit_t > (z >> s_bits);
+
+			auto b = static_cast < digit_t > (static_cast < wide_t > (m) * m_modulus >> s_bits);
+
+			return a >= b ? a - b : a - b + m_modulus;
+		}
+
+//  ------------------------------------------------------------------------------------------
+
+		constexpr auto add(digit_t x, digit_t y) const
+		{
+			return x >= m_modulus - y ? x - (m_modulus - y) : x + y;
+		}
+
+//  ------------------------------------------------------------------------------------------
+
+		constexpr auto subtract(digit_t x, digit_t y) const
+		{
+			return x >= y ? x - y : x - y + m_modulus;
+		}
+
+//  ------------------------------------------------------------------------------------------
+
+		constexpr auto to  (digit_t x) const { return multiply(x % m_modulus, m_square); }
+
+		constexpr auto from(digit_t x) const { return multiply(x, 1); }
+
+//  ------------------------------------------------------------------------------------------
+
+		constexpr auto power(digit_t x, digit_t exponent) const
+		{
+			auto y = to(1);
+
+			for (; exponent; exponent >>= 1, x = multiply(x, x))
+			{
+				if (exponent & 1)
+				{
+					y = multiply(y, x);
+				}
+			}
+
+			return y;
+		}
+
+	private :
+
+		digit_t m_modulus = 0, m_inverse = 0, m_square = 0;
+	};
+
+//  ------------------------------------------------------------------------------------------
+
+	static void transform(std::span < digit_t > x, Montgomery const & modulus, digit_t root, bool is_inverse)
+	{
+		auto size = std::size(x);
+
+		auto & workspace = Workspace::current();
+
+		Workspace::Frame frame(workspace);
+
+		auto roots = workspace.allocate(std::max(size, 2uz));
+
+		for (auto step = 1uz; step < size; step *= 2)
+		{
+			auto w = modulus.power(root, (modulus.modulus() - 1) / (2 * step));
+
+			if (is_inverse)
+			{
+				w = modulus.power(w, modulus.modulus() - 2);
+			}
+
+			roots[step] = modulus.to(1);
+
+			for (auto i = step + 1; i < 2 * step; ++i)
+			{
+				roots[i] = modulus.multiply(roots[i - 1], w);
+			}
+		}
+
+		auto blocks = is_parallel(size) ? threads() : 1uz;
+
+		auto butterfly = [&](std::size_t step)
+		{
+			auto shift = std::countr_zero(step);
+
+			parallel_for(blocks > 1, blocks, [&](std::size_t block)
+			{
+				for (auto k = size / 2 * block / blocks; k < size / 2 * (block + 1) / blocks; ++k)
+				{
+					auto i = k >> shift << (shift + 1), j = k & (step - 1);
+
+					auto & a = x[i + j], & b = x[i + j + step];
+
+					if (is_inverse)
+					{
+						auto c = modulus.multiply(b, roots[step + j]);
+
+						b = modulus.subtract(a, c);
+
+						a = modulus.add(a, c);
+					}
+					else
+					{
+						auto c = modulus.subtract(a, b);
+
+						a = modulus.add(a, b);
+
+						b = modulus.multiply(c, roots[step + j]);
+					}
+				}
+			});
+		};
+
+		if (is_inverse)
+		{
+			for (auto step = 1uz; step < size; step *= 2) 
+			{
+				butterfly(step);
+			}
+		}
+		else
+		{
+			for (auto step = size / 2; step > 0; step /= 2) 
+			{
+				butterfly(step);
+			}
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void mul_ntt(std::span < digit_t > z, std::span < digit_t const > x, std::span < digit_t const > y)
+	{
+		auto size = std::bit_ceil(std::size(x) + std::size(y) - 1);
+
+		auto & workspace = Workspace::current();
+
+		Workspace::Frame frame(workspace);
+
+		auto is_parallel = Integer::is_parallel(size);
+
+		std::span < digit_t > residues[std::size(s_primes)], buffers[std::size(s_primes)];
+
+		for (auto k = 0uz; k < std::size(s_primes); ++k)
+		{
+			residues[k] = workspace.allocate(size);
+
+			buffers[k] = is_parallel || k == 0 ? workspace.allocate(size) : buffers[0];
+		}
+
+		parallel_for(is_parallel, std::size(s_primes), [&](std::size_t k)
+		{
+			Montgomery modulus(s_primes[k].modulus);
+
+			auto residue = residues[k], buffer = buffers[k];
+
+			std::ranges::transform(x, residue.begin(), [&](auto digit){ return modulus.to(digit); });
+
+			transform(residue, modulus, modulus.to(s_primes[k].root), false);
+
+			if (x.data() == y.data() && std::size(x) == std::size(y))
+			{
+				std::ranges::copy(residue, buffer.begin());
+			}
+			else
+			{
+				std::ranges::fill(buffer, 0);
+
+				std::ranges::transform(y, buffer.begin(), [&](auto digit){ return modulus.to(digit); });
+
+				transform(buffer, modulus, modulus.to(s_primes[k].root), false);
+			}
+
+			for (auto i = 0uz; i < size; ++i)
+			{
+				residue[i] = modulus.multiply(residue[i], buffer[i]);
+			}
+
+			transform(residue, modulus, modulus.to(s_primes[k].root), true);
+
+			auto scale = modulus.power(modulus.to(size), modulus.modulus() - 2);
+
+			for (auto & digit : residue)
+			{
+				digit = modulus.from(modulus.multiply(digit, scale));
+			}
+		});
+
+		combine(z, residues[0], residues[1], residues[2]);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void combine
+	(
+		std::span < digit_t       > z, 
+		std::span < digit_t const > r1, 
+		std::span < digit_t const > r2, 
+		std::span < digit_t const > r3
+	)
+	{
+		Montgomery const m1(s_primes[0].modulus), m2(s_primes[1].modulus), m3(s_primes[2].modulus);
+
+		auto p1 = m1.modulus(), p2 = m2.modulus(), p3 = m3.modulus();
+
+		auto p12 = static_cast < wide_t > (p1) * p2;
+
+		auto p12_lo = static_cast < digit_t > (p12), p12_hi = static_cast < digit_t > (p12 >> s_bits);
+
+		auto c12 = m2.power(m2.to(p1), p2 - 2);
+
+		auto c123 = m3.power(m3.multiply(m3.to(p1), m3.to(p2)), p3 - 2);
+
+		wide_t carry = 0;
+
+		for (auto i = 0uz; i < std::size(z); ++i)
+		{
+			digit_t v0 = 0, v1 = 0, v2 = 0;
+
+			if (i + 1 < std::size(z))
+			{
+				auto a = r1[i] >= p2 ? r1[i] - p2 : r1[i];
+
+				auto t = m2.multiply(m2.subtract(r2[i], a), c12);
+
+				auto x12 = r1[i] + static_cast < wide_t > (p1) * t;
+
+				auto x12_lo = static_cast < digit_t > (x12), x12_hi = static_cast < digit_t > (x12 >> s_bits);
+
+				auto u = m3.multiply(m3.subtract(r3[i], m3.add(m3.to(x12_hi), x12_lo % p3)), c123);
+
+				auto lo = static_cast < wide_t > (p12_lo) * u + x12_lo;
+
+				auto hi = static_cast < wide_t > (p12_hi) * u + x12_hi + static_cast < digit_t > (lo >> s_bits);
+
+				v0 = static_cast < digit_t > (lo);
+
+				v1 = static_cast < digit_t > (hi);
+				
+				v2 = static_cast < digit_t > (hi >> s_bits);
+			}
+
+			auto s0 = static_cast < wide_t > (v0) + static_cast < digit_t > (carry);
+
+			auto s1 = static_cast < wide_t > (v1) + static_cast < digit_t > (carry >> s_bits) + static_cast < digit_t > (s0 >> s_bits);
+
+			z[i] = static_cast < digit_t > (s0);
+
+			carry = static_cast < wide_t > (v2 + static_cast < digit_t > (s1 >> s_bits)) << s_bits | static_cast < digit_t > (s1);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto shift_left(std::span < digit_t > z, std::span < digit_t const > x, int shift) -> digit_t
+	{
+		digit_t carry = 0;
+
+		for (auto i = 0uz; i < std::size(x); ++i)
+		{
+			auto digit = x[i];
+
+			z[i] = digit << shift | carry;
+
+			carry = shift ? digit >> (s_bits - shift) : 0;
+		}
+
+		return carry;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void shift_right(std::span < digit_t > z, std::span < digit_t const > x, int shift)
+	{
+		for (auto i = 0uz; i < std::size(x); ++i)
+		{
+			auto carry = shift && i + 1 < std::size(x) ? x[i + 1] << (s_bits - shift) : 0;
+
+			z[i] = x[i] >> shift | carry;
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void div_knuth(std::span < digit_t > q, std::span < digit_t > u, std::span < digit_t const > v)
+	{
+		auto size = std::size(v);
+
+		auto v1 = v[size - 1], v2 = v[size - 2];
+
+		for (auto j = std::size(q); j-- > 0;)
+		{
+			auto x = static_cast < wide_t > (u[j + size]) << s_bits | u[j + size - 1];
+
+			auto digit = x / v1, remainder = x % v1;
+
+			if (digit >> s_bits)
+			{
+				digit = std::numeric_limits < digit_t > ::max();
+
+				remainder = x - digit * v1;
+			}
+
+			while (!(remainder >> s_bits) && digit * v2 > (remainder << s_bits | u[j + size - 2]))
+			{
+				--digit;
+
+				remainder += v1;
+			}
+
+			auto d = static_cast < digit_t > (digit);
+
+			digit_t carry = 0, borrow = 0;
+
+			for (auto i = 0uz; i < size; ++i)
+			{
+				auto product = static_cast < wide_t > (d) * v[i] + carry;
+
+				carry = static_cast < digit_t > (product >> s_bits);
+
+				auto difference = static_cast < wide_t > (u[i + j]) - static_cast < digit_t > (product) - borrow;
+
+				u[i + j] = static_cast < digit_t > (difference);
+
+				borrow = static_cast < digit_t > (difference >> s_bits) & 1;
+			}
+
+			auto difference = static_cast < wide_t > (u[j + size]) - carry - borrow;
+
+			u[j + size] = static_cast < digit_t > (difference);
+
+			if (difference >> s_bits)
+			{
+				--d;
+
+				u[j + size] += add_to(u.subspan(j, size), v);
+			}
+
+			q[j] = d;
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void assign_product(IntegerView const & x, IntegerView const & y)
+	{
+		m_digits.clear();
+
+		m_digits.resize(std::max(std::size(x.digits()) + std::size(y.digits()), 1uz), 0);
+
+		if (!std::empty(x.digits()) && !std::empty(y.digits()))
+		{
+			mul(digits(), x.digits(), y.digits());
+		}
+
+		m_is_negative = x.is_negative() ^ y.is_negative();
+
+		reduce();
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void mul(std::span < digit_t > z, std::span < digit_t const > x, std::span < digit_t const > y)
+	{
+		auto & workspace = Workspace::current();
+
+		Workspace::Frame frame(workspace);
+
+		std::span < digit_t > scratch;
+
+		if (auto size = std::min(std::size(x), std::size(y)); size >= karatsuba_threshold() && size < s_ntt_threshold)
+		{
+			scratch = workspace.allocate(scratch_size(std::max(std::size(x), std::size(y))));
+		}
+
+		mul(z, x, y, scratch);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto add_product(Integer const & x, Integer const & y, bool is_negative) -> Integer &
+	{
+		if (this == &x || this == &y)
+		{
+			return add(x * y, is_negative);
+		}
+
+		if (x == 0 || y == 0)
+		{
+			return *this;
+		}
+
+		if (m_is_negative == is_negative || *this == 0)
+		{
+			m_is_negative = is_negative;
+
+			accumulate_product(x.digits(), y.digits());
+
+			reduce();
+
+			return *this;
+		}
+
+		auto & workspace = Workspace::current();
+
+		Workspace::Frame frame(workspace);
+
+		auto z = workspace.allocate(std::size(x.m_digits) + std::size(y.m_digits));
+
+		mul(z, x.digits(), y.digits());
+
+		return add(z.first(std::size(z) - !z.back()), is_negative);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void accumulate_product(std::span < digit_t const > x, std::span < digit_t const > y)
+	{
+		if (std::size(x) < std::size(y))
+		{
+			std::swap(x, y);
+		}
+
+		while (std::size(m_digits) > 1 && !m_digits.back())
+		{
+			m_digits.pop_back();
+		}
+
+		m_digits.resize(std::max(std::size(m_digits), std::size(x) + std::size(y)) + 1, 0);
+
+		if (std::size(y) < karatsuba_threshold())
+		{
+			for (auto i = 0uz; i < std::size(y); ++i)
+			{
+				auto carry = mul_add_n(digits().subspan(i), x, y[i]);
+
+				add_to(digits().subspan(i + std::size(x)), { &carry, 1 });
+			}
+		}
+		else
+		{
+			auto & workspace = Workspace::current();
+
+			Workspace::Frame frame(workspace);
+
+			auto z = workspace.allocate(std::size(x) + std::size(y));
+
+			mul(z, x, y);
+
+			add_to(digits(), z);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static void add_product_carry_save
+	(
+		std::span < digit_t       > z,
+		std::span < digit_t       > carries,
+		std::span < digit_t const > x,
+		std::span < digit_t const > y
+	)
+	{
+		if (std::size(x) < std::size(y))
+		{
+			std::swap(x, y);
+		}
+
+		if (std::size(y) < karatsuba_threshold())
+		{
+			for (auto i = 0uz; i < std::size(y); ++i)
+			{
+				auto carry = mul_add_n(z.subspan(i), x, y[i]);
+
+				auto & digit = z[i + std::size(x)];
+
+				digit += carry;
+
+				carries[i + std::size(x) + 1] += digit < carry;
+			}
+		}
+		else
+		{
+			auto & workspace = Workspace::current();
+
+			Workspace::Frame frame(workspace);
+
+			auto product = workspace.allocate(std::size(x) + std::size(y));
+
+			mul(product, x, y);
+
+			add_carry_save(z.data(), carries.data() + 1, product.data(), std::size(product));
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto scratch(std::size_t index) -> Integer &
+	{
+		thread_local Integer integers[2];
+
+		return integers[index];
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto operand(Lazy const & x) -> Integer const & { return x.value; }
+
+	template < typename E > static auto operand(E const & expression) -> Integer { return expression; }
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename E > void assign(E const & expression)
+	{
+		if (expression.contains(*this))
+		{
+			auto & x = scratch(0);
+
+			x.evaluate(expression);
+
+			swap(x);
+		}
+		else
+		{
+			evaluate(expression);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void evaluate(Lazy const & x)
+	{
+		*this = x.value;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename L, typename R > void evaluate(Expression < L, R, '*' > const & expression)
+	{
+		auto && x = operand(expression.lhs);
+
+		auto && y = operand(expression.rhs);
+
+		assign_product(x, y);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename L, typename R, char O > void evaluate(Expression < L, R, O > const & expression)
+	{
+		evaluate(expression.lhs);
+
+		accumulate(expression.rhs, O == '-');
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void accumulate(Lazy const & x, bool is_subtraction)
+	{
+		add(x.value, x.value.m_is_negative ^ is_subtraction);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename L, typename R > void accumulate(Expression < L, R, '*' > const & expression, bool is_subtraction)
+	{
+		auto & x = scratch(1);
+
+		x.evaluate(expression);
+
+		add(x, x.m_is_negative ^ is_subtraction);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename E > void accumulate(E const & expression, bool is_subtraction)
+	{
+		Integer x = expression;
+
+		add(x, x.m_is_negative ^ is_subtraction);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void reduce()
+	{
+		m_hash.value.store(0, std::memory_order_relaxed);
+
+		while (std::size(m_digits) > 1 && !m_digits.back()) 
+		{
+			m_digits.pop_back();
+		}
+
+		if (std::size(m_digits) == 1 && !m_digits.front())
+		{
+			m_is_negative = false;
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < std::integral T > static auto magnitude(T value) -> digit_t
+	{
+		return value < 0 ? 0 - static_cast < digit_t > (value) : static_cast < digit_t > (value);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto add_small(digit_t digit, bool is_negative) -> Integer &
+	{
+		if (m_is_negative == is_negative)
+		{
+			if (add_to(digits(), { &digit, 1 }))
+			{
+				m_digits.push_back(1);
+			}
+		}
+		else if (std::size(m_digits) == 1 && m_digits.front() < digit)
+		{
+			m_digits.front() = digit - m_digits.front();
+
+			m_is_negative = is_negative;
+		}
+		else 
+		{
+			sub_from(digits(), { &digit, 1 });
+		}
+
+		reduce();
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto add(Integer const & other, bool is_negative) -> Integer &
+	{
+		return add(other.digits(), is_negative);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto add(IntegerView const & other, bool is_negative) -> Integer &
+	{
+		auto first = other.digits().data(), begin = std::as_const(m_digits).data(), end = begin + std::size(m_digits);
+
+		if (!std::empty(other.digits()) && !std::less < > ()(first, begin) && std::less < > ()(first, end))
+		{
+			return add(Integer(other), is_negative);
+		}
+
+		return add(other.digits(), is_negative);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto add(std::span < digit_t const > other, bool is_negative) -> Integer &
+	{
+		if (m_is_negative == is_negative)
+		{
+			auto size = std::max(std::size(m_digits), std::size(other));
+
+			m_digits.resize(size, 0);
+
+			if (add_to(digits(), other))
+			{
+				m_digits.push_back(1);
+			}
+		}
+		else if (this->less(other))
+		{
+			m_digits.resize(std::size(other), 0);
+
+			sub_reverse(digits(), other);
+
+			m_is_negative = is_negative;
+		}
+		else 
+		{
+			sub_from(digits(), other);
+		}
+
+		reduce();
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto less(Integer const & other) const -> bool
+	{
+		return less(other.digits());
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto mix(digit_t x, digit_t y) -> digit_t
+	{
+		auto z = static_cast < wide_t > (x) * y;
+
+		return static_cast < digit_t > (z) ^ static_cast < digit_t > (z >> s_bits);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto less(std::span < digit_t const > other) const -> bool
+	{
+		if (std::size(m_digits) != std::size(other)) 
+		{
+			return std::size(m_digits) < std::size(other);
+		}
+
+		return compare(m_digits.data(), other.data(), std::size(m_digits)) < 0;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	struct hash_t
+	{
+		hash_t() = default;
+
+		hash_t(hash_t const &) noexcept {}
+
+		auto operator=(hash_t const &) noexcept -> hash_t &
+		{
+			value.store(0, std::memory_order_relaxed);
+
+			return *this;
+		}
+
+		mutable std::atomic < std::size_t > value = 0;
+	};
+
+//  ------------------------------------------------------------------------------------------
+
+	struct task_t
+	{
+		template < typename F > task_t(F const & function) : object(&function), invoke(&call < F > ) {}
+
+		void operator()() const { invoke(object); }
+
+		template < typename F > static void call(void const * object) { (*static_cast < F const * > (object))(); }
+
+		void const * object = nullptr;
+
+		void (*invoke)(void const *) = nullptr;
+	};
+
+//  ------------------------------------------------------------------------------------------
+
+	bool m_is_negative = false;
+
+	SmallVector < digit_t, 4, PoolAllocator < digit_t > > m_digits;
+
+	hash_t m_hash;
+
+//  ------------------------------------------------------------------------------------------
+
+	static constexpr auto s_bits = std::numeric_limits < digit_t > ::digits;
+
+	static constexpr auto s_step = std::numeric_limits < digit_t > ::digits10;
+
+	static inline auto s_radix = static_cast < digit_t > (std::pow(10, s_step));
+
+	static inline auto s_convert_threshold = 32uz;
+
+	static constexpr auto s_product_leaf = 16uz;
+
+	static constexpr std::array < char, 4 > s_magic = { 'I', 'N', 'T', 'G' };
+
+	static constexpr std::uint16_t s_version = 1;
+
+	static constexpr auto s_read_chunk = 1uz << 16;
+
+	static constexpr digit_t s_seeds[] = 
+	{ 
+		0xa0'76'1d'64'78'bd'64'2f, 0xe7'03'7e'd1'a0'b4'28'db, 0x8e'bc'6a'f0'9c'88'c6'e3, 0x58'99'65'cc'75'37'4c'c3 
+	};
+
+	struct prime_t { digit_t modulus = 0, root = 0; };
+
+	static constexpr prime_t s_primes[] =
+	{
+		{ 0x7f'ff'fe'00'00'00'00'01, 7 },
+		{ 0x7f'ff'e4'00'00'00'00'01, 3 },
+		{ 0x7f'ff'e0'00'00'00'00'01, 5 }
+	};
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < typename T > concept operand = is_expression_v < T > || std::same_as < T, Integer > ;
+
+template < typename L, typename R > concept binary_expression = 
+
+	operand < std::remove_cvref_t < L > > && operand < std::remove_cvref_t < R > > && 
+	
+	(is_expression_v < std::remove_cvref_t < L > > || is_expression_v < std::remove_cvref_t < R > > );
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template <> struct std::hash < Integer >
+{
+	using is_transparent = void;
+
+	auto operator()(Integer const & x) const noexcept { return x.hash(); }
+
+	auto operator()(std::span < Integer::digit_t const > x) const noexcept { return Integer::hash(x); }
+
+	auto operator()(IntegerView const & x) const noexcept { return Integer::hash(x.digits(), x.is_negative()); }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+auto multiply(IntegerView const & x, IntegerView const & y) -> Integer;
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline IntegerView::IntegerView(Integer const & x) : IntegerView(x.digits(), x.m_is_negative) {}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto IntegerView::compare(IntegerView const & x, IntegerView const & y) -> int
+{
+	if (std::size(x.m_digits) != std::size(y.m_digits))
+	{
+		return std::size(x.m_digits) < std::size(y.m_digits) ? -1 : 1;
+	}
+
+	return Integer::compare(x.m_digits.data(), y.m_digits.data(), std::size(x.m_digits));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto operator==(IntegerView const & lhs, IntegerView const & rhs) -> bool
+{
+	return lhs.m_is_negative == rhs.m_is_negative && IntegerView::compare(lhs, rhs) == 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto operator<=>(IntegerView const & lhs, IntegerView const & rhs) -> std::strong_ordering
+{
+	if (lhs.m_is_negative != rhs.m_is_negative)
+	{
+		return lhs.m_is_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+	}
+
+	auto result = IntegerView::compare(lhs, rhs);
+
+	return (lhs.m_is_negative ? -result : result) <=> 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto IntegerView::to_string() const -> std::string
+{
+	std::string string(1 + (bit_length() / (Integer::s_bits - 1) + 1) * Integer::s_step, '\0');
+
+	auto [end, error] = Integer::print(string.data(), string.data() + std::size(string), *this);
+
+	string.resize(static_cast < std::size_t > (end - string.data()));
+
+	return string;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto operator<<(std::ostream & stream, IntegerView const & x) -> std::ostream &
+{
+	return stream << x.to_string();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto lazy(Integer const & x) { return Lazy { x }; }
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < char O, operand L, operand R > auto make_expression(L const & lhs, R const & rhs)
+{
+	auto wrap = [](auto const & x)
+	{
+		if constexpr (std::is_same_v < std::remove_cvref_t < decltype(x) > , Integer > )
+		{
+			return Lazy { x };
+		}
+		else
+		{
+			return x;
+		}
+	};
+
+	return Expression < decltype(wrap(lhs)), decltype(wrap(rhs)), O > { wrap(lhs), wrap(rhs) };
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < typename L, typename R > requires binary_expression < L, R >
+
+auto operator+(L && lhs, R && rhs) { return make_expression < '+' > (lhs, rhs); }
+
+template < typename L, typename R > requires binary_expression < L, R >
+
+auto operator-(L && lhs, R && rhs) { return make_expression < '-' > (lhs, rhs); }
+
+template < typename L, typename R > requires binary_expression < L, R >
+
+auto operator*(L && lhs, R && rhs) { return make_expression < '*' > (lhs, rhs); }
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class Integer::NoReduction
+{
+public :
+
+	auto one() const { return Integer(1); }
+
+	auto to  (Integer const & x) const { return x; }
+
+	auto from(Integer const & x) const { return x; }
+
+	auto multiply(Integer const & x, Integer const & y) const { return x * y; }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class Integer::MontgomeryReduction
+{
+public :
+
+	explicit MontgomeryReduction(Integer const & modulus) : m_modulus(modulus), m_size(std::size(modulus.m_digits))
+	{
+		digit_t inverse = 1;
+
+		for (auto i = 0; i < 6; ++i)
+		{
+			inverse *= 2 - modulus.m_digits.front() * inverse;
+		}
+
+		m_inverse = 0 - inverse;
+
+		if (m_size >= karatsuba_threshold())
+		{
+			Integer x = inverse;
+
+			for (auto size = 1uz; size < m_size; size *= 2)
+			{
+				auto r = Integer(2) + Integer(1).shift_left(2 * size * s_bits);
+
+				x = (x * (r - ::multiply(IntegerView(modulus).slice(0, 2 * size), x).slice(0, 2 * size))).slice(0, 2 * size);
+			}
+
+			m_inverses = Integer(1).shift_left(m_size * s_bits) - x.slice(0, m_size);
+		}
+
+		m_one = Integer(1).shift_left(m_size * s_bits) % modulus;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto one() const { return m_one; }
+
+	auto to  (Integer const & x) const { return x.shift_left(m_size * s_bits) % m_modulus; }
+
+	auto from(Integer const & x) const { return reduce(x); }
+
+	auto multiply(Integer const & x, Integer const & y) const { return reduce(x * y); }
+
+private :
+
+	auto reduce(Integer const & x) const -> Integer
+	{
+		Integer y;
+
+		if (m_size < karatsuba_threshold())
+		{
+			auto t = x;
+
+			t.m_digits.resize(2 * m_size + 1, 0);
+
+			auto z = t.digits();
+
+			for (auto i = 0uz; i < m_size; ++i)
+			{
+				auto carry = mul_add_n(z.subspan(i), m_modulus.digits(), z[i] * m_inverse);
+
+				for (auto k = i + m_size; carry; ++k)
+				{
+					z[k] += carry;
+
+					carry = z[k] < carry;
+				}
+			}
+
+			y = t.slice(m_size, m_size + 1);
+		}
+		else
+		{
+			auto u = ::multiply(IntegerView(x).slice(0, m_size), m_inverses).slice(0, m_size);
+
+			y = (x + u * m_modulus).slice(m_size, m_size + 1);
+		}
+
+		if (!y.less(m_modulus))
+		{
+			y -= m_modulus;
+		}
+
+		return y;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	Integer m_modulus, m_inverses, m_one;
+
+	std::size_t m_size = 0;
+
+	digit_t m_inverse = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class Integer::BarrettReduction
+{
+public :
+
+	explicit BarrettReduction(Integer const & modulus) : m_modulus(modulus), m_size(std::size(modulus.m_digits))
+	{
+		m_inverse = Integer(1).shift_left(2 * m_size * s_bits) / modulus;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto one() const { return Integer(1); }
+
+	auto to  (Integer const & x) const { return x; }
+
+	auto from(Integer const & x) const { return x; }
+
+	auto multiply(Integer const & x, Integer const & y) const { return reduce(x * y); }
+
+private :
+
+	auto reduce(Integer const & x) const -> Integer
+	{
+		auto q = (x.shift_right((m_size - 1) * s_bits) * m_inverse).shift_right((m_size + 1) * s_bits);
+
+		auto y = x - q * m_modulus;
+
+		while (!y.less(m_modulus))
+		{
+			y -= m_modulus;
+		}
+
+		return y;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	Integer m_modulus, m_inverse;
+
+	std::size_t m_size = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline Integer pow(const Integer& base, unsigned int exp)
+{
+	return Integer::exponentiate(Integer::NoReduction(), base, exp);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto powmod(Integer const & base, Integer const & exponent, Integer const & modulus) -> Integer
+{
+	if (modulus == 0)
+	{
+		throw std::domain_error("zero modulus");
+	}
+
+	if (exponent.m_is_negative)
+	{
+		throw std::domain_error("negative exponent");
+	}
+
+	auto m = modulus.abs();
+
+	if (m == 1)
+	{
+		return 0;
+	}
+
+	auto x = base % m;
+
+	if (x.m_is_negative)
+	{
+		x += m;
+	}
+
+	if (m.m_digits.front() & 1)
+	{
+		return Integer::exponentiate(Integer::MontgomeryReduction(m), x, exponent);
+	}
+
+	return Integer::exponentiate(Integer::BarrettReduction(m), x, exponent);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < integer_range R > auto product(R && range) -> Integer
+{
+	if constexpr (std::ranges::random_access_range < R > && std::ranges::sized_range < R > )
+	{
+		return Integer::product_tree(range, 0, std::ranges::size(range), 0uz);
+	}
+	else
+	{
+		std::vector < std::ranges::range_value_t < R > > x;
+
+		for (auto && element : range)
+		{
+			x.push_back(std::forward < decltype(element) > (element));
+		}
+
+		return product(x);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class Rational
+{
+public :
+
+	Rational() : m_denominator(1) {}
+
+	Rational(Integer numerator) : m_numerator(std::move(numerator)), m_denominator(1) {}
+
+	template < std::integral T > Rational(T value) : Rational(Integer(value)) {}
+
+	Rational(Integer numerator, Integer denominator) 
+	: 
+		m_numerator(std::move(numerator)), m_denominator(std::move(denominator)) 
+	{
+		if (m_denominator == 0)
+		{
+			throw std::domain_error("zero denominator");
+		}
+
+		if (m_denominator < 0)
+		{
+			m_numerator = -std::move(m_numerator);
+
+			m_denominator = -std::move(m_denominator);
+		}
+
+		if (auto g = gcd(m_numerator, m_denominator); g != 1)
+		{
+			m_numerator /= g;
+
+			m_denominator /= g;
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto const & numerator  () const { return m_numerator;   }
+
+	auto const & denominator() const { return m_denominator; }
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator+=(Rational const & other) { return add(other, false); }
+
+	auto & operator-=(Rational const & other) { return add(other, true ); }
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator*=(Rational const & other)
+	{
+		auto g_1 = gcd(m_numerator, other.m_denominator), g_2 = gcd(other.m_numerator, m_denominator);
+
+		m_numerator = (m_numerator / g_1) * (other.m_numerator / g_2);
+
+		m_denominator = (m_denominator / g_2) * (other.m_denominator / g_1);
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto & operator/=(Rational const & other)
+	{
+		if (other.m_numerator == 0)
+		{
+			throw std::domain_error("division by zero");
+		}
+
+		auto inverse = other;
+
+		inverse.m_numerator.swap(inverse.m_denominator);
+
+		if (inverse.m_denominator < 0)
+		{
+			inverse.m_numerator = -std::move(inverse.m_numerator);
+
+			inverse.m_denominator = -std::move(inverse.m_denominator);
+		}
+
+		return *this *= inverse;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator- (Rational x) { x.m_numerator = -std::move(x.m_numerator); return x; }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator+ (Rational lhs, Rational const & rhs) { return lhs += rhs; }
+
+	friend auto operator- (Rational lhs, Rational const & rhs) { return lhs -= rhs; }
+
+	friend auto operator* (Rational lhs, Rational const & rhs) { return lhs *= rhs; }
+
+	friend auto operator/ (Rational lhs, Rational const & rhs) { return lhs /= rhs; }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto operator< (Rational const & lhs, Rational const & rhs)
+	{
+		return lhs.m_numerator * rhs.m_denominator < rhs.m_numerator * lhs.m_denominator;
+	}
+
+	friend auto operator==(Rational const & lhs, Rational const & rhs) -> bool
+	{
+		return lhs.m_numerator == rhs.m_numerator && lhs.m_denominator == rhs.m_denominator;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto & operator<<(std::ostream & stream, Rational const & rational)
+	{
+		stream << rational.m_numerator;
+
+		if (rational.m_denominator != 1)
+		{
+			stream << '/' << rational.m_denominator;
+		}
+
+		return stream;
+	}
+
+private :
+
+	auto add(Rational const & other, bool is_subtraction) -> Rational &
+	{
+		auto g = gcd(m_denominator, other.m_denominator);
+
+		auto x = m_numerator * (other.m_denominator / g), y = other.m_numerator * (m_denominator / g);
+
+		is_subtraction ? x -= y : x += y;
+
+		auto h = g == 1 ? g : gcd(x, g);
+
+		m_numerator = x / h;
+
+		m_denominator = (m_denominator / g) * (other.m_denominator / h);
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	Integer m_numerator, m_denominator;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < std::size_t Bits > class FixedInteger
+{
+public :
+
+	static_assert(Bits > 0 && Bits % std::numeric_limits < Integer::digit_t > ::digits == 0);
+
+	using digit_t = Integer::digit_t;
+
+	using wide_t = Integer::wide_t;
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr FixedInteger() = default;
+
+	template < std::integral T > constexpr FixedInteger(T value)
+	{
+		m_digits[0] = static_cast < digit_t > (value);
+
+		if (value < 0)
+		{
+			std::ranges::fill(std::span(m_digits).subspan(1), ~digit_t(0));
+		}
+	}
+
+	constexpr explicit FixedInteger(std::string_view string)
+	{
+		auto is_negative = !std::empty(string) && string.front() == '-';
+
+		if (!std::empty(string) && (string.front() == '-' || string.front() == '+'))
+		{
+			string.remove_prefix(1);
+		}
+
+		if (std::empty(string))
+		{
+			throw std::invalid_argument("invalid integer");
+		}
+
+		for (auto i = 0uz; i < std::size(string); i += s_step)
+		{
+			auto chunk = string.substr(i, s_step);
+
+			digit_t digit = 0, scale = 1;
+
+			for (auto c : chunk)
+			{
+				if (c < '0' || c > '9')
+				{
+					throw std::invalid_argument("invalid integer");
+				}
+
+				digit = digit * 10 + static_cast < digit_t > (c - '0');
+
+				scale *= 10;
+			}
+
+			mul_add_small(scale, digit);
+		}
+
+		if (is_negative)
+		{
+			negate();
+		}
+	}
+
+	template < std::same_as < Integer > I > explicit FixedInteger(I const & x)
+	{
+		std::ranges::copy(x.digits().first(std::min(std::size(x.m_digits), s_size)), m_digits.begin());
+
+		if (x.m_is_negative)
+		{
+			negate();
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	explicit operator Integer() const
+	{
+		auto x = Integer::make_integer(is_negative() ? (-*this).m_digits : m_digits);
+
+		x.m_is_negative = is_negative();
+
+		x.reduce();
+
+		return x;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto & operator+=(FixedInteger const & other)
+	{
+		wide_t carry = 0;
+
+		for (auto i = 0uz; i < s_size; ++i)
+		{
+			carry += static_cast < wide_t > (m_digits[i]) + other.m_digits[i];
+
+			m_digits[i] = static_cast < digit_t > (carry);
+
+			carry >>= s_bits;
+		}
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto & operator-=(FixedInteger const & other)
+	{
+		return *this += -other;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto & operator*=(FixedInteger const & other)
+	{
+		std::array < digit_t, s_size > z = {};
+
+		for (auto i = 0uz; i < s_size; ++i)
+		{
+			wide_t carry = 0;
+
+			for (auto j = 0uz; i + j < s_size; ++j)
+			{
+				carry += static_cast < wide_t > (m_digits[i]) * other.m_digits[j] + z[i + j];
+
+				z[i + j] = static_cast < digit_t > (carry);
+
+				carry >>= s_bits;
+			}
+		}
+
+		m_digits = z;
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto & operator/=(FixedInteger const & other) { return *this = divmod(*this, other).first;  }
+
+	constexpr auto & operator%=(FixedInteger const & other) { return *this = divmod(*this, other).second; }
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto & operator&=(FixedInteger const & other) { return bitwise(other, std::bit_and < > ()); }
+
+	constexpr auto & operator|=(FixedInteger const & other) { return bitwise(other, std::bit_or  < > ()); }
+
+	constexpr auto & operator^=(FixedInteger const & other) { return bitwise(other, std::bit_xor < > ()); }
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto & operator<<=(std::size_t shift)
+	{
+		std::array < digit_t, s_size > z = {};
+
+		if (auto step = shift / s_bits, offset = shift % s_bits; step < s_size)
+		{
+			for (auto i = s_size; i-- > step;)
+			{
+				z[i] = m_digits[i - step] << offset;
+
+				if (offset && i > step)
+				{
+					z[i] |= m_digits[i - step - 1] >> (s_bits - offset);
+				}
+			}
+		}
+
+		m_digits = z;
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto & operator>>=(std::size_t shift)
+	{
+		digit_t fill = is_negative() ? ~digit_t(0) : 0;
+
+		std::array < digit_t, s_size > z;
+
+		z.fill(fill);
+
+		if (auto step = shift / s_bits, offset = shift % s_bits; step < s_size)
+		{
+			for (auto i = 0uz; i + step < s_size; ++i)
+			{
+				auto next = i + step + 1 < s_size ? m_digits[i + step + 1] : fill;
+
+				z[i] = offset ? m_digits[i + step] >> offset | next << (s_bits - offset) : m_digits[i + step];
+			}
+		}
+
+		m_digits = z;
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto const operator++(int) { auto x = *this; *this += 1; return x; }
+
+	constexpr auto const operator--(int) { auto x = *this; *this -= 1; return x; }
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto & operator++() { return *this += 1; }
+
+	constexpr auto & operator--() { return *this -= 1; }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend constexpr auto operator- (FixedInteger x) { x.negate(); return x; }
+
+	friend constexpr auto operator~ (FixedInteger x) { for (auto & digit : x.m_digits) digit = ~digit; return x; }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend constexpr auto operator+ (FixedInteger lhs, FixedInteger const & rhs) { return lhs += rhs; }
+
+	friend constexpr auto operator- (FixedInteger lhs, FixedInteger const & rhs) { return lhs -= rhs; }
+
+	friend constexpr auto operator* (FixedInteger lhs, FixedInteger const & rhs) { return lhs *= rhs; }
+
+	friend constexpr auto operator/ (FixedInteger lhs, FixedInteger const & rhs) { return lhs /= rhs; }
+
+	friend constexpr auto operator% (FixedInteger lhs, FixedInteger const & rhs) { return lhs %= rhs; }
+
+	friend constexpr auto operator& (FixedInteger lhs, FixedInteger const & rhs) { return lhs &= rhs; }
+
+	friend constexpr auto operator| (FixedInteger lhs, FixedInteger const & rhs) { return lhs |= rhs; }
+
+	friend constexpr auto operator^ (FixedInteger lhs, FixedInteger const & rhs) { return lhs ^= rhs; }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend constexpr auto operator<<(FixedInteger lhs, std::size_t shift) { return lhs <<= shift; }
+
+	friend constexpr auto operator>>(FixedInteger lhs, std::size_t shift) { return lhs >>= shift; }
+
+//  ------------------------------------------------------------------------------------------
+
+	friend constexpr auto operator<=>(FixedInteger const & lhs, FixedInteger const & rhs) -> std::strong_ordering
+	{
+		if (lhs.is_negative() != rhs.is_negative())
+		{
+			return lhs.is_negative() ? std::strong_ordering::less : std::strong_ordering::greater;
+		}
+
+		return compare(lhs.m_digits, rhs.m_digits);
+	}
+
+	friend constexpr auto operator== (FixedInteger const & lhs, FixedInteger const & rhs) -> bool = default;
+
+//  ------------------------------------------------------------------------------------------
+
+	friend auto & operator>>(std::istream & stream, FixedInteger & integer)
+	{
+		std::string string;
+
+		stream >> string;
+
+		integer = FixedInteger(string);
+
+		return stream;
+	}
+
+	friend auto & operator<<(std::ostream & stream, FixedInteger const & integer)
+	{
+		return stream << integer.to_string();
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto to_string() const -> std::string
+	{
+		auto x = abs();
+
+		std::vector < digit_t > chunks;
+
+		do
+		{
+			chunks.push_back(x.divmod_small(s_radix));
+		}
+		while (x != 0);
+
+		std::string string = is_negative() ? "-" : "";
+
+		string += std::to_string(chunks.back());
+
+		for (auto i = std::ssize(chunks) - 2; i >= 0; --i)
+		{
+			auto chunk = std::to_string(chunks[i]);
+
+			string.append(s_step - std::size(chunk), '0').append(chunk);
+		}
+
+		return string;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto is_negative() const -> bool
+	{
+		return m_digits.back() >> (s_bits - 1);
+	}
+
+	constexpr auto sign() const -> int
+	{
+		return is_negative() ? -1 : *this != 0;
+	}
+
+	constexpr auto abs() const
+	{
+		return is_negative() ? -*this : *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto bit_length() const -> std::size_t
+	{
+		auto x = abs();
+
+		for (auto i = s_size; i-- > 0;)
+		{
+			if (x.m_digits[i])
+			{
+				return (i + 1) * s_bits - std::countl_zero(x.m_digits[i]);
+			}
+		}
+
+		return 0;
+	}
+
+	constexpr auto test_bit(std::size_t index) const -> bool
+	{
+		return index < Bits ? m_digits[index / s_bits] >> (index % s_bits) & 1 : is_negative();
+	}
+
+	constexpr auto trailing_zeros() const -> std::size_t
+	{
+		for (auto i = 0uz; i < s_size; ++i)
+		{
+			if (m_digits[i])
+			{
+				return i * s_bits + std::countr_zero(m_digits[i]);
+			}
+		}
+
+		return 0;
+	}
+
+	constexpr auto popcount() const -> std::size_t
+	{
+		auto x = abs(), count = 0uz;
+
+		for (auto digit : x.m_digits)
+		{
+			count += std::popcount(digit);
+		}
+
+		return count;
+	}
+
+private :
+
+	static constexpr auto s_bits = std::numeric_limits < digit_t > ::digits;
+
+	static constexpr auto s_size = Bits / s_bits;
+
+	static constexpr auto s_step = std::numeric_limits < digit_t > ::digits10;
+
+	static constexpr auto s_radix = digit_t(10'000'000'000'000'000'000ull);
+
+//  ------------------------------------------------------------------------------------------
+
+	using digits_t = std::array < digit_t, s_size > ;
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr void negate()
+	{
+		digit_t carry = 1;
+
+		for (auto & digit : m_digits)
+		{
+			digit = ~digit + carry;
+
+			carry = carry && !digit;
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	template < typename F > constexpr auto bitwise(FixedInteger const & other, F f) -> FixedInteger &
+	{
+		for (auto i = 0uz; i < s_size; ++i)
+		{
+			m_digits[i] = f(m_digits[i], other.m_digits[i]);
+		}
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr void mul_add_small(digit_t factor, digit_t addend)
+	{
+		for (auto & digit : m_digits)
+		{
+			auto x = static_cast < wide_t > (digit) * factor + addend;
+
+			digit = static_cast < digit_t > (x);
+
+			addend = static_cast < digit_t > (x >> s_bits);
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	constexpr auto divmod_small(digit_t divisor) -> digit_t
+	{
+		wide_t remainder = 0;
+
+		for (auto i = s_size; i-- > 0;)
+		{
+			auto x = remainder << s_bits | m_digits[i];
+
+			m_digits[i] = static_cast < digit_t > (x / divisor);
+
+			remainder = x % divisor;
+		}
+
+		return static_cast < digit_t > (remainder);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static constexpr auto compare(digits_t const & x, digits_t const & y) -> std::strong_ordering
+	{
+		for (auto i = s_size; i-- > 0;)
+		{
+			if (x[i] != y[i])
+			{
+				return x[i] <=> y[i];
+			}
+		}
+
+		return std::strong_ordering::equal;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static constexpr auto divmod(FixedInteger const & x, FixedInteger const & y) -> std::pair < FixedInteger, FixedInteger >
+	{
+		if (y == 0)
+		{
+			throw std::domain_error("division by zero");
+		}
+
+		auto [q, r] = divmod_unsigned(x.abs().m_digits, y.abs().m_digits);
+
+		if (x.is_negative() != y.is_negative())
+		{
+			q.negate();
+		}
+
+		if (x.is_negative())
+		{
+			r.negate();
+		}
+
+		return { q, r };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static constexpr auto divmod_unsigned(digits_t const & u, digits_t const & v) -> std::pair < FixedInteger, FixedInteger >
+	{
+		FixedInteger q, r;
+
+		auto n = s_size, m = s_size;
+
+		while (n > 1 && !v[n - 1])
+		{
+			--n;
+		}
+
+		while (m > 1 && !u[m - 1])
+		{
+			--m;
+		}
+
+		if (compare(u, v) < 0)
+		{
+			r.m_digits = u;
+		}
+		else if (n == 1)
+		{
+			q.m_digits = u;
+
+			r.m_digits[0] = q.divmod_small(v[0]);
+		}
+		else
+		{
+			auto shift = std::countl_zero(v[n - 1]);
+
+			std::array < digit_t, s_size + 1 > a = {};
+
+			digits_t b = {};
+
+			for (auto i = 0uz; i < m; ++i)
+			{
+				a[i] |= u[i] << shift;
+
+				a[i + 1] = shift ? u[i] >> (s_bits - shift) : 0;
+			}
+
+			for (auto i = 0uz; i < n; ++i)
+			{
+				b[i] = v[i] << shift | (shift && i ? v[i - 1] >> (s_bits - shift) : 0);
+			}
+
+			for (auto j = m - n + 1; j-- > 0;)
+			{
+				auto top = static_cast < wide_t > (a[j + n]) << s_bits | a[j + n - 1];
+
+				auto q_hat = top / b[n - 1], r_hat = top % b[n - 1];
+
+				while (q_hat >> s_bits || q_hat * b[n - 2] > (r_hat << s_bits | a[j + n - 2]))
+				{
+					--q_hat;
 
-				m_digits[i + 1]++;
+					if ((r_hat += b[n - 1]) >> s_bits)
+					{
+						break;
+					}
+				}
+
+				digit_t carry = 0, borrow = 0;
+
+				for (auto i = 0uz; i < n; ++i)
+				{
+					auto p = q_hat * b[i] + carry;
+
+					carry = static_cast < digit_t > (p >> s_bits);
+
+					auto t = static_cast < wide_t > (a[i + j]) - static_cast < digit_t > (p) - borrow;
+
+					a[i + j] = static_cast < digit_t > (t);
+
+					borrow = static_cast < digit_t > (t >> s_bits) & 1;
+				}
+
+				auto t = static_cast < wide_t > (a[j + n]) - carry - borrow;
+
+				a[j + n] = static_cast < digit_t > (t);
+
+				q.m_digits[j] = static_cast < digit_t > (q_hat);
+
+				if (t >> s_bits)
+				{
+					--q.m_digits[j];
+
+					wide_t sum = 0;
+
+					for (auto i = 0uz; i < n; ++i)
+					{
+						sum += static_cast < wide_t > (a[i + j]) + b[i];
+
+						a[i + j] = static_cast < digit_t > (sum);
+
+						sum >>= s_bits;
+					}
+
+					a[j + n] += static_cast < digit_t > (sum);
+				}
+			}
+
+			for (auto i = 0uz; i < n; ++i)
+			{
+				r.m_digits[i] = shift ? a[i] >> shift | a[i + 1] << (s_bits - shift) : a[i];
 			}
 		}
 
-		m_size += m_digits[m_size];
+		return { q, r };
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	digits_t m_digits = {};
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class Accumulator
+{
+public :
+
+	using digit_t = Integer::digit_t;
+
+	using carry_t = std::uint16_t;
+
+//  ------------------------------------------------------------------------------------------
+
+	static inline auto s_limit = static_cast < std::size_t > (std::numeric_limits < carry_t > ::max());
+
+//  ------------------------------------------------------------------------------------------
+
+	Accumulator() = default;
+
+	explicit Accumulator(Integer const & x) { *this += x; }
+
+//  ------------------------------------------------------------------------------------------
+
+	auto operator+=(Integer const & x) -> Accumulator &
+	{
+		add(m_parts[x.m_is_negative], x.digits());
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto operator-=(Integer const & x) -> Accumulator &
+	{
+		add(m_parts[!x.m_is_negative], x.digits());
 
 		return *this;
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	auto subtract(Integer const & other) -> Integer &
+	auto value() const -> Integer
+	{
+		return resolve(m_parts[0]) - resolve(m_parts[1]);
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	explicit operator Integer() const { return value(); }
+
+//  ------------------------------------------------------------------------------------------
+
+	void normalize()
+	{
+		auto x = value();
+
+		for (auto & part : m_parts)
+		{
+			part = part_t();
+		}
+
+		*this += x;
+	}
+
+private :
+
+	struct part_t
+	{
+		std::vector < digit_t > sums;
+
+		std::vector < carry_t > carries;
+
+		std::size_t size = 0;
+	};
+
+//  ------------------------------------------------------------------------------------------
+
+	void add(part_t & part, std::span < digit_t const > x)
+	{
+		if (part.size >= std::min < std::size_t > (s_limit, std::numeric_limits < carry_t > ::max()))
+		{
+			normalize();
+		}
+
+		if (std::size(part.sums) < std::size(x) + 1)
+		{
+			part.sums.resize(std::size(x) + 1, 0);
+
+			part.carries.resize(std::size(x) + 1, 0);
+		}
+
+		Integer::add_carry_save(part.sums.data(), part.carries.data() + 1, x.data(), std::size(x));
+
+		++part.size;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	static auto resolve(part_t const & part) -> Integer
 	{
-		for (auto i = 0uz; i < m_size; ++i)
+		Integer x;
+
+		if (!std::empty(part.sums))
 		{
-			m_digits[i] -= other.m_digits[i];
+			x.m_digits.resize(std::size(part.sums) + 1, 0);
+
+			Integer::wide_t carry = 0;
 
-			if (m_digits[i] < 0)
+			for (auto i = 0uz; i < std::size(part.sums); ++i)
 			{
-				m_digits[i] += s_base;
+				carry += static_cast < Integer::wide_t > (part.sums[i]) + part.carries[i];
 
-				m_digits[i + 1]--;
+				x.m_digits[i] = static_cast < digit_t > (carry);
+
+				carry >>= Integer::s_bits;
 			}
+
+			x.m_digits.back() = static_cast < digit_t > (carry);
+
+			x.reduce();
 		}
 
-		reduce();
-		
-		return *this;
+		return x;
 	}
 
 //  ------------------------------------------------------------------------------------------
 
-	auto less(Integer const & other) const -> bool
+	part_t m_parts[2];
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < integer_range R > auto sum(R && range) -> Integer
+{
+	if constexpr (std::ranges::random_access_range < R > && std::ranges::sized_range < R > )
 	{
-		if (m_size != other.m_size) 
+		auto size = std::ranges::size(range);
+
+		auto is_parallel = Integer::threads() > 1 && Integer::limbs(range, 0, size) >= Integer::s_parallel_sum_threshold;
+
+		std::vector < Accumulator > accumulators(is_parallel ? Integer::threads() : 1uz);
+
+		Integer::parallel_for(is_parallel, std::size(accumulators), [&](std::size_t i)
+		{
+			auto first = std::ranges::begin(range);
+
+			for (auto j = size * i / std::size(accumulators); j < size * (i + 1) / std::size(accumulators); ++j)
+			{
+				if constexpr (std::same_as < std::ranges::range_value_t < R > , Integer > )
+				{
+					accumulators[i] += first[j];
+				}
+				else
+				{
+					accumulators[i] += Integer(first[j]);
+				}
+			}
+		});
+
+		for (auto i = 1uz; i < std::size(accumulators); ++i)
 		{
-			return m_size < other.m_size;
+			accumulators.front() += accumulators[i].value();
 		}
 
-		for (auto i = static_cast < int > (m_size) - 1; i >= 0; --i)
+		return accumulators.front().value();
+	}
+	else
+	{
+		Accumulator accumulator;
+
+		for (auto && element : range)
 		{
-			if (m_digits[i] != other.m_digits[i]) 
+			if constexpr (std::same_as < std::ranges::range_value_t < R > , Integer > )
 			{
-				return m_digits[i] < other.m_digits[i];
+				accumulator += element;
+			}
+			else
+			{
+				accumulator += Integer(element);
 			}
 		}
 
-		return false;
+		return accumulator.value();
 	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__unix__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+class IntegerFile
+{
+public :
+
+	using digit_t = Integer::digit_t;
+
+	struct record_t
+	{
+		bool is_negative = false;
+
+		std::span < digit_t const > digits;
+	};
 
 //  ------------------------------------------------------------------------------------------
 
-	bool m_is_negative = false;
+	explicit IntegerFile(std::string const & path)
+	{
+		auto descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+		if (descriptor < 0)
+		{
+			throw std::system_error(errno, std::generic_category(), path);
+		}
 
-	std::vector < digit_t > m_digits;
+		struct ::stat status = {};
 
-	std::size_t m_size = 0;
+		auto is_mapped = ::fstat(descriptor, &status) == 0;
+
+		if (is_mapped && (m_size = static_cast < std::size_t > (status.st_size)) > 0)
+		{
+			m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+			is_mapped = m_data != MAP_FAILED;
+		}
+
+		auto error = errno;
+
+		::close(descriptor);
+
+		if (!is_mapped)
+		{
+			m_data = nullptr;
+
+			throw std::system_error(error, std::generic_category(), path);
+		}
+
+		try
+		{
+			index();
+		}
+		catch (...)
+		{
+			unmap();
+
+			throw;
+		}
+	}
 
 //  ------------------------------------------------------------------------------------------
 
-	static inline auto s_size = 1'000uz;
+	IntegerFile(IntegerFile && other) noexcept : 
+	
+		m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)), 
+		
+		m_records(std::move(other.m_records)) 
+	{}
 
-	static inline auto s_step = std::numeric_limits < digit_t > ::digits10 / 2;
+//  ------------------------------------------------------------------------------------------
 
-	static inline auto s_base = static_cast < digit_t > (std::pow(10, s_step));
-};
+	auto & operator=(IntegerFile && other) noexcept
+	{
+		if (this != &other)
+		{
+			unmap();
 
-inline Integer operator%(const Integer& lhs, const Integer& rhs)
-{
-	Integer result = lhs;
-	result %= rhs;
-	return result;
-}
+			m_data = std::exchange(other.m_data, nullptr);
 
-inline Integer pow(const Integer& base, unsigned int exp)
-{
-	if (exp == 0)
-    {
-        return Integer(1);
-    }
+			m_size = std::exchange(other.m_size, 0);
+
+			m_records = std::move(other.m_records);
+		}
+
+		return *this;
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	IntegerFile(IntegerFile const &) = delete;
+
+	auto & operator=(IntegerFile const &) = delete;
+
+//  ------------------------------------------------------------------------------------------
+
+   ~IntegerFile()
+	{
+		unmap();
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	auto size() const { return std::size(m_records); }
+
+	auto begin() const { return std::begin(m_records); }
+
+	auto end  () const { return std::end  (m_records); }
+
+	auto & operator[](std::size_t index) const { return m_records[index]; }
+
+//  ------------------------------------------------------------------------------------------
+
+	auto integer(std::size_t index) const
+	{
+		auto & record = m_records[index];
+
+		Integer x;
+
+		x.m_digits.resize(std::size(record.digits));
 
-	Integer result(1);
-	Integer b = base;
+		std::ranges::copy(record.digits, x.m_digits.begin());
 
-	unsigned int e = exp;
-	while (e > 0)
+		x.m_is_negative = record.is_negative;
+
+		return x;
+	}
+
+private :
+
+	void index()
+	{
+		std::span < std::byte const > bytes(static_cast < std::byte const * > (m_data), m_size);
+
+		for (auto offset = 0uz; offset < m_size;)
+		{
+			auto header = Integer::load_header(bytes.subspan(offset));
+
+			offset += sizeof(Integer::header_t);
+
+			if ((m_size - offset) / sizeof(digit_t) < header.size)
+			{
+				throw std::invalid_argument("invalid binary integer");
+			}
+
+			record_t record = { header.flags == 1, { reinterpret_cast < digit_t const * > (bytes.data() + offset), header.size } };
+
+			Integer::check_record(record.is_negative, record.digits);
+
+			m_records.push_back(record);
+
+			offset += record.digits.size_bytes();
+		}
+	}
+
+//  ------------------------------------------------------------------------------------------
+
+	void unmap()
 	{
-		if (e & 1)
-        {
-            result = result * b;
-        }
-		b = b * b;
-		e >>= 1;
+		if (m_data)
+		{
+			::munmap(m_data, m_size);
+		}
 	}
 
-	return result;
-}
\ No newline at end of file
+//  ------------------------------------------------------------------------------------------
+
+	void * m_data = nullptr;
+
+	std::size_t m_size = 0;
+
+	std::vector < record_t > m_records;
+};
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////////
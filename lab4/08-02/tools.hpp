@@ -0,0 +1,88 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+// chapter : Number Processing
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+// section : Long Arithmetic
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+// content : Random Operands and Timing Loop Shared by Calibration and Benchmark Tools
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "task.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto make_string(std::size_t length, std::mt19937_64 & engine)
+{
+	std::uniform_int_distribution distribution('0', '9');
+
+	std::string string(length, '0');
+
+	for (auto & digit : string)
+	{
+		digit = distribution(engine);
+	}
+
+	string.front() = '1';
+
+	return string;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto make_integer(std::size_t size, std::mt19937_64 & engine)
+{
+	auto length = static_cast < std::size_t > (size * std::numeric_limits < Integer::digit_t > ::digits * std::log10(2));
+
+	return Integer(make_string(length, engine));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+template < typename F > auto measure(F && f)
+{
+	using clock_t = std::chrono::steady_clock;
+
+	auto time = std::numeric_limits < double > ::max();
+
+	for (auto i = 0; i < 5; ++i)
+	{
+		auto count = 0uz;
+
+		auto begin = clock_t::now(), end = begin;
+
+		do
+		{
+			f();
+
+			++count;
+
+			end = clock_t::now();
+		}
+		while (end - begin < std::chrono::milliseconds(20));
+
+		time = std::min(time, std::chrono::duration < double, std::micro > (end - begin).count() / count);
+	}
+
+	return time;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////